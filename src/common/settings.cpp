@@ -150,12 +150,19 @@ void OrchestratorSettings::_register_settings()
     // Orchestrator v2
     _settings.emplace_back(RESOURCE_SETTING("settings/default_type", "Object", "Node"));
     _settings.emplace_back(SENUM_SETTING("settings/storage_format", "Text,Binary", "Text"));
+    _settings.emplace_back(INT_SETTING("settings/parallel_load_threshold", 256));
     _settings.emplace_back(SENUM_SETTING("settings/log_level", "FATAL,ERROR,WARN,INFO,DEBUG,TRACE", "INFO"));
     _settings.emplace_back(BOOL_SETTING("settings/notify_about_pre-releases", false));
     _settings.emplace_back(FILE_SETTING("settings/dialogue/default_message_scene", "*.tscn,*.scn", "res://addons/orchestrator/scenes/dialogue_message.tscn"));
 
     _settings.emplace_back(RANGE_SETTING("settings/runtime/max_call_stack", "256,1024,256", 1024));
     _settings.emplace_back(INT_SETTING("settings/runtime/max_loop_iterations", 1000000));
+    _settings.emplace_back(BOOL_SETTING("settings/runtime/cache_input_actions", true));
+    _settings.emplace_back(INT_SETTING("settings/runtime/random_seed", 0));
+    _settings.emplace_back(INT_SETTING("settings/runtime/error_report_interval_ms", 1000));
+    _settings.emplace_back(FILE_SETTING("settings/runtime/execution_recording_path", "*.orec", ""));
+
+    _settings.emplace_back(BOOL_SETTING("settings/debug/verify_reference_index", false));
 
     _settings.emplace_back(BOOL_SETTING("ui/actions_menu/center_on_mouse", true));
 
@@ -173,6 +180,8 @@ void OrchestratorSettings::_register_settings()
     _settings.emplace_back(BOOL_SETTING("ui/graph/show_minimap", false));
     _settings.emplace_back(BOOL_SETTING("ui/graph/show_arrange_button", false));
     _settings.emplace_back(BOOL_SETTING("ui/graph/show_overlay_action_tooltips", true));
+    _settings.emplace_back(INT_SETTING("ui/graph/hibernate_hidden_graphs_after", 300));
+    _settings.emplace_back(INT_SETTING("ui/graph/population_frame_budget_ms", 8));
     _settings.emplace_back(COLOR_NO_ALPHA_SETTING("ui/graph/knot_selected_color", Color(0.68f, 0.44f, 0.09f)));
 
     _settings.emplace_back(BOOL_SETTING("ui/nodes/show_type_icons", true));
@@ -19,6 +19,8 @@
 #include "common/callable_lambda.h"
 #include "common/name_utils.h"
 #include "common/scene_utils.h"
+#include "editor/build_output_panel.h"
+#include "editor/plugins/orchestrator_editor_plugin.h"
 
 #include <godot_cpp/classes/accept_dialog.hpp>
 #include <godot_cpp/classes/button.hpp>
@@ -90,6 +92,15 @@ void OrchestratorScriptComponentPanel::_tree_item_edited()
         return;
     }
 
+    // Re-key the item so the next update renames it in place rather than recreating it
+    if (_items.has(old_name) && _items[old_name] == item)
+    {
+        _items.erase(old_name);
+        _items[new_name] = item;
+        item->set_meta("__key", new_name);
+        item->set_meta("__name", new_name);
+    }
+
     _queue_update();
 }
 
@@ -172,8 +183,15 @@ void OrchestratorScriptComponentPanel::_iterate_tree_item(TreeItem* p_item, cons
 
 void OrchestratorScriptComponentPanel::_queue_update()
 {
-    // Queue update for the next frame
-    callable_mp_lambda(this, [=] { update(); }).call_deferred();
+    // Queue update for the next frame, coalescing multiple requests
+    if (_update_queued)
+        return;
+
+    _update_queued = true;
+    callable_mp_lambda(this, [=] {
+        _update_queued = false;
+        update();
+    }).call_deferred();
 }
 
 void OrchestratorScriptComponentPanel::_iterate_tree_items(const Callable& p_callback)
@@ -223,18 +241,6 @@ void OrchestratorScriptComponentPanel::_disconnect_slot(TreeItem* p_item)
     }
 }
 
-TreeItem* OrchestratorScriptComponentPanel::_create_item(TreeItem* p_parent, const String& p_text, const String& p_item_name, const String& p_icon_name)
-{
-    TreeItem* item = p_parent->create_child();
-    item->set_text(0, p_text);
-    item->set_meta("__name", p_item_name);
-    item->set_meta("__rollback_name", p_text);
-    if (!p_icon_name.is_empty())
-        item->set_icon(0, SceneUtils::get_editor_icon(p_icon_name));
-
-    return item;
-}
-
 String OrchestratorScriptComponentPanel::_get_tree_item_name(TreeItem* p_item)
 {
     return p_item ? p_item->get_meta("__name") : "";
@@ -276,10 +282,83 @@ void OrchestratorScriptComponentPanel::_update_theme()
     _theme_changing = false;
 }
 
-void OrchestratorScriptComponentPanel::_clear_tree()
+void OrchestratorScriptComponentPanel::_begin_update()
 {
-    _tree->clear();
-    _tree->create_item();
+    _stale_items.clear();
+    for (const KeyValue<String, TreeItem*>& E : _items)
+        _stale_items.insert(E.key);
+}
+
+TreeItem* OrchestratorScriptComponentPanel::_update_item(const String& p_key, TreeItem* p_parent, TreeItem* p_after,
+                                                         const String& p_text, const String& p_item_name, const String& p_icon_name)
+{
+    _stale_items.erase(p_key);
+
+    TreeItem* item = nullptr;
+    if (const HashMap<String, TreeItem*>::Iterator E = _items.find(p_key))
+    {
+        item = E->value;
+        if (item->get_parent() != p_parent)
+        {
+            _remove_item(p_key);
+            item = nullptr;
+        }
+    }
+
+    if (!item)
+    {
+        item = p_parent->create_child();
+        item->set_meta("__key", p_key);
+        if (!p_icon_name.is_empty())
+            item->set_icon(0, SceneUtils::get_editor_icon(p_icon_name));
+
+        _items[p_key] = item;
+    }
+
+    if (item->get_text(0) != p_text)
+        item->set_text(0, p_text);
+
+    if (!p_item_name.is_empty())
+    {
+        item->set_meta("__name", p_item_name);
+        item->set_meta("__rollback_name", p_text);
+    }
+
+    // Only move the item when it's not already in the expected position
+    if (p_after && item->get_prev() != p_after)
+        item->move_after(p_after);
+    else if (!p_after && p_parent->get_first_child() != item)
+        item->move_before(p_parent->get_first_child());
+
+    return item;
+}
+
+void OrchestratorScriptComponentPanel::_end_update()
+{
+    for (const String& key : _stale_items)
+        _remove_item(key);
+
+    _stale_items.clear();
+}
+
+void OrchestratorScriptComponentPanel::_remove_item(const String& p_key)
+{
+    const HashMap<String, TreeItem*>::Iterator E = _items.find(p_key);
+    if (!E)
+        return;
+
+    TreeItem* item = E->value;
+
+    // Children are freed with the item, so their keys must be released too
+    _iterate_tree_item(item, callable_mp_lambda(this, [this](TreeItem* child) {
+        if (child->has_meta("__key"))
+            _items.erase(child->get_meta("__key"));
+    }));
+
+    if (TreeItem* parent = item->get_parent())
+        parent->remove_child(item);
+
+    memdelete(item);
 }
 
 void OrchestratorScriptComponentPanel::_edit_selected_tree_item()
@@ -332,6 +411,29 @@ void OrchestratorScriptComponentPanel::_confirm_removal(TreeItem* p_item)
     _confirm->popup_centered();
 }
 
+void OrchestratorScriptComponentPanel::_show_references(const String& p_type, const String& p_name, const Vector<int>& p_node_ids)
+{
+    OrchestratorPlugin::get_singleton()->make_build_panel_active();
+    OrchestratorBuildOutputPanel* build_panel = OrchestratorPlugin::get_singleton()->get_build_panel();
+
+    const String path = _orchestration->get_self()->get_path();
+
+    build_panel->reset();
+    build_panel->add_message(vformat("[b]Orchestration File:[/b] %s\n\n", path));
+    build_panel->add_message(vformat("Found %d reference(s) to %s '%s'.\n", p_node_ids.size(), p_type, p_name));
+
+    for (int node_id : p_node_ids)
+    {
+        const Ref<OScriptNode> node = _orchestration->get_node(node_id);
+        if (!node.is_valid())
+            continue;
+
+        const Ref<OScriptGraph> graph = node->get_owning_graph();
+        build_panel->add_message(vformat("Node #[url={\"goto_node\":\"%d\",\"script\":\"%s\"}]%d - %s[/url] in graph '%s'\n",
+            node_id, path, node_id, node->get_node_title(), graph.is_valid() ? graph->get_graph_name() : String()));
+    }
+}
+
 String OrchestratorScriptComponentPanel::_create_unique_name_with_prefix(const String& p_prefix)
 {
     return NameUtils::create_unique_name(p_prefix, _get_existing_names());
@@ -471,6 +573,11 @@ void OrchestratorScriptComponentPanel::_notification(int p_what)
         ProjectSettings* settings = ProjectSettings::get_singleton();
         settings->connect("settings_changed", callable_mp(this, &OrchestratorScriptComponentPanel::update));
 
+        // Model changes are applied incrementally on the next frame
+        const StringName model_signal = _get_model_changed_signal();
+        if (!model_signal.is_empty())
+            _orchestration->get_self()->connect(model_signal, callable_mp(this, &OrchestratorScriptComponentPanel::_queue_update));
+
         // Connections
         _collapse_button->connect("pressed", callable_mp(this, &OrchestratorScriptComponentPanel::_toggle));
         _add_button->connect("pressed", callable_mp(this, &OrchestratorScriptComponentPanel::_tree_add_item));
@@ -21,6 +21,7 @@
 
 #include <godot_cpp/classes/input_event.hpp>
 #include <godot_cpp/classes/v_box_container.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
 
 using namespace godot;
 
@@ -60,6 +61,9 @@ protected:
     bool _expanded{ true };                   //! Whether the section is currently expanded
     bool _theme_changing{ false };            //! Whether the theme is being changed
     bool _update_blocked{ false };
+    bool _update_queued{ false };             //! Whether an update is queued for the next frame
+    HashMap<String, TreeItem*> _items;        //! Tree items by key, persisted between updates
+    HashSet<String> _stale_items;             //! Keys of tree items not yet visited by the current update
 
     //~ Begin Signal handlers
     void _toggle();
@@ -82,13 +86,6 @@ protected:
     /// @param p_item the tree item
     void _disconnect_slot(TreeItem* p_item);
 
-    /// Creates an item in the tree.
-    /// @param p_parent the parent
-    /// @param p_text the display text
-    /// @param p_item_name the item name
-    /// @param p_icon_name the icon
-    TreeItem* _create_item(TreeItem* p_parent, const String& p_text, const String& p_item_name, const String& p_icon_name);
-
     /// Get the item's real name
     /// @param p_item the tree item
     /// @return the item's real name
@@ -97,8 +94,26 @@ protected:
     /// Updates the control's theme.
     void _update_theme();
 
-    /// Clears the tree of all items but the root.
-    void _clear_tree();
+    /// Begins an incremental update of the tree, marking all existing items as stale.
+    void _begin_update();
+
+    /// Gets the tree item for the given key, creating it if it doesn't exist or belongs to another parent.
+    /// Items are positioned after the given sibling, so visiting items in display order keeps the tree sorted.
+    /// @param p_key the unique key of the item
+    /// @param p_parent the parent item
+    /// @param p_after the sibling the item is placed after, or null to place it first
+    /// @param p_text the display text
+    /// @param p_item_name the item name, or empty for items that are not model elements
+    /// @param p_icon_name the icon, only applied when the item is created
+    /// @return the tree item
+    TreeItem* _update_item(const String& p_key, TreeItem* p_parent, TreeItem* p_after, const String& p_text, const String& p_item_name, const String& p_icon_name);
+
+    /// Ends an incremental update of the tree, removing all items that were not visited.
+    void _end_update();
+
+    /// Removes the tree item with the given key, including all of its children.
+    /// @param p_key the unique key of the item
+    void _remove_item(const String& p_key);
 
     /// Edit the selected tree item
     void _edit_selected_tree_item();
@@ -119,6 +134,12 @@ protected:
     /// @param p_item the item to be removed, should not be null
     void _confirm_removal(TreeItem* p_item);
 
+    /// Lists the nodes that reference an orchestration element in the build output panel.
+    /// @param p_type the element type, i.e. "variable"
+    /// @param p_name the element name
+    /// @param p_node_ids the unique IDs of the referencing nodes
+    void _show_references(const String& p_type, const String& p_name, const Vector<int>& p_node_ids);
+
     /// Creates a unique name in the tree with the given prefix.
     /// This is useful to guarantee that all new items have a unique name.
     /// @param p_prefix the prefix to use
@@ -144,6 +165,10 @@ protected:
     /// @return packed string array of all existing object names
     virtual PackedStringArray _get_existing_names() const { return {}; }
 
+    /// Get the orchestration signal that is emitted when the panel's model elements change.
+    /// @return the signal name, or an empty name if the panel isn't driven by a model signal
+    virtual StringName _get_model_changed_signal() const { return {}; }
+
     /// Get the tooltip text for the panel header.
     /// @return the tooltip text to be shown.
     virtual String _get_tooltip_text() const { return {}; }
@@ -100,6 +100,7 @@ bool OrchestratorScriptFunctionsComponentPanel::_populate_context_menu(TreeItem*
     _context_menu->add_item("Open in Graph", CM_OPEN_FUNCTION_GRAPH, KEY_ENTER);
     _context_menu->add_icon_item(SceneUtils::get_editor_icon("Rename"), "Rename", CM_RENAME_FUNCTION, KEY_F2);
     _context_menu->add_icon_item(SceneUtils::get_editor_icon("Remove"), "Remove", CM_REMOVE_FUNCTION, KEY_DELETE);
+    _context_menu->add_icon_item(SceneUtils::get_editor_icon("Search"), "Find References", CM_FIND_FUNCTION_REFERENCES);
 
     if (p_item->has_meta("__slot") && p_item->get_meta("__slot"))
     {
@@ -123,6 +124,12 @@ void OrchestratorScriptFunctionsComponentPanel::_handle_context_menu(int p_id)
         case CM_REMOVE_FUNCTION:
             _confirm_removal(_tree->get_selected());
             break;
+        case CM_FIND_FUNCTION_REFERENCES:
+        {
+            const String name = _get_tree_item_name(_tree->get_selected());
+            _show_references("function", name, _orchestration->get_function_references(name));
+            break;
+        }
         case CM_DISCONNECT_SLOT:
             _disconnect_slot(_tree->get_selected());
             break;
@@ -248,11 +255,12 @@ void OrchestratorScriptFunctionsComponentPanel::update()
     if (_update_blocked)
         return;
 
-    _clear_tree();
+    _begin_update();
 
     OrchestratorSettings* settings = OrchestratorSettings::get_singleton();
     bool use_friendly_names = settings->get_setting("ui/components_panel/show_function_friendly_names", true);
 
+    TreeItem* last_item = nullptr;
     for (const Ref<OScriptGraph>& graph : _orchestration->get_graphs())
     {
         if (!(graph->get_flags().has_flag(OScriptGraph::GraphFlags::GF_FUNCTION)))
@@ -262,17 +270,19 @@ void OrchestratorScriptFunctionsComponentPanel::update()
         if (use_friendly_names)
             friendly_name = graph->get_graph_name().capitalize();
 
-        _create_item(_tree->get_root(), friendly_name, graph->get_graph_name(), "MemberMethod");
+        last_item = _update_item(graph->get_graph_name(), _tree->get_root(), last_item, friendly_name, graph->get_graph_name(), "MemberMethod");
     }
 
-    if (_tree->get_root()->get_child_count() == 0)
+    if (!last_item)
     {
-        TreeItem* item = _tree->get_root()->create_child();
-        item->set_text(0, "No functions defined");
+        TreeItem* item = _update_item("@empty", _tree->get_root(), nullptr, "No functions defined", "", "");
         item->set_selectable(0, false);
+        _end_update();
         return;
     }
 
+    _end_update();
+
     _update_slots();
 
     OrchestratorScriptComponentPanel::update();
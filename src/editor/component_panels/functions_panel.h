@@ -31,7 +31,8 @@ class OrchestratorScriptFunctionsComponentPanel : public OrchestratorScriptCompo
         CM_OPEN_FUNCTION_GRAPH,
         CM_RENAME_FUNCTION,
         CM_REMOVE_FUNCTION,
-        CM_DISCONNECT_SLOT
+        CM_DISCONNECT_SLOT,
+        CM_FIND_FUNCTION_REFERENCES
     };
 
     Button* _override_button{ nullptr };
@@ -43,6 +44,7 @@ protected:
     //~ Begin OrchestratorScriptComponentPanel Interface
     String _get_unique_name_prefix() const override { return "NewFunction"; }
     PackedStringArray _get_existing_names() const override;
+    StringName _get_model_changed_signal() const override { return "functions_changed"; }
     String _get_tooltip_text() const override;
     String _get_remove_confirm_text(TreeItem* p_item) const override;
     String _get_item_name() const override { return "Function"; }
@@ -260,14 +260,14 @@ void OrchestratorScriptGraphsComponentPanel::update()
     if (_update_blocked)
         return;
 
-    _clear_tree();
+    _begin_update();
 
     Vector<Ref<OScriptGraph>> graphs = _orchestration->get_graphs();
     if (graphs.is_empty())
     {
-        TreeItem* item = _tree->get_root()->create_child();
-        item->set_text(0, "No graphs defined");
+        TreeItem* item = _update_item("@empty", _tree->get_root(), nullptr, "No graphs defined", "", "");
         item->set_selectable(0, false);
+        _end_update();
         return;
     }
 
@@ -275,6 +275,7 @@ void OrchestratorScriptGraphsComponentPanel::update()
     bool use_friendly_names = settings->get_setting("ui/components_panel/show_graph_friendly_names", true);
 
     const PackedStringArray functions = _orchestration->get_function_names();
+    TreeItem* last_item = nullptr;
     for (const Ref<OScriptGraph>& graph : graphs)
     {
         if (!(graph->get_flags().has_flag(OScriptGraph::GraphFlags::GF_EVENT)))
@@ -284,8 +285,10 @@ void OrchestratorScriptGraphsComponentPanel::update()
         if (use_friendly_names)
             friendly_name = friendly_name.capitalize();
 
-        TreeItem* item = _create_item(_tree->get_root(), friendly_name, graph->get_graph_name(), "ClassList");
+        TreeItem* item = _update_item(graph->get_graph_name(), _tree->get_root(), last_item, friendly_name, graph->get_graph_name(), "ClassList");
+        last_item = item;
 
+        TreeItem* last_event_item = nullptr;
         for (const String& function_name : functions)
         {
             int function_id = _orchestration->get_function_node_id(function_name);
@@ -295,11 +298,15 @@ void OrchestratorScriptGraphsComponentPanel::update()
                 if (use_friendly_names)
                     friendly_name = vformat("%s Event", function_name.capitalize());
 
-                _create_item(item, friendly_name, function_name, "PlayStart");
+                // Event keys are scoped by graph, as graph and function names share a namespace
+                const String key = vformat("%s/%s", graph->get_graph_name(), function_name);
+                last_event_item = _update_item(key, item, last_event_item, friendly_name, function_name, "PlayStart");
             }
         }
     }
 
+    _end_update();
+
     _update_slots();
 
     OrchestratorScriptComponentPanel::update();
@@ -42,6 +42,7 @@ protected:
     //~ Begin OrchestratorScriptComponentPanel Interface
     String _get_unique_name_prefix() const override { return "NewEventGraph"; }
     PackedStringArray _get_existing_names() const override;
+    StringName _get_model_changed_signal() const override { return "functions_changed"; }
     String _get_tooltip_text() const override;
     String _get_remove_confirm_text(TreeItem* p_item) const override;
     String _get_item_name() const override { return "EventGraph"; }
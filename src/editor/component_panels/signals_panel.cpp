@@ -46,6 +46,7 @@ bool OrchestratorScriptSignalsComponentPanel::_populate_context_menu(TreeItem* p
 {
     _context_menu->add_icon_item(SceneUtils::get_editor_icon("Rename"), "Rename", CM_RENAME_SIGNAL, KEY_F2);
     _context_menu->add_icon_item(SceneUtils::get_editor_icon("Remove"), "Remove", CM_REMOVE_SIGNAL, KEY_DELETE);
+    _context_menu->add_icon_item(SceneUtils::get_editor_icon("Search"), "Find References", CM_FIND_SIGNAL_REFERENCES);
     return true;
 }
 
@@ -59,6 +60,12 @@ void OrchestratorScriptSignalsComponentPanel::_handle_context_menu(int p_id)
         case CM_REMOVE_SIGNAL:
             _confirm_removal(_tree->get_selected());
             break;
+        case CM_FIND_SIGNAL_REFERENCES:
+        {
+            const String name = _get_tree_item_name(_tree->get_selected());
+            _show_references("signal", name, _orchestration->get_signal_references(name));
+            break;
+        }
     }
 }
 
@@ -144,28 +151,28 @@ void OrchestratorScriptSignalsComponentPanel::update()
     if (_update_blocked)
         return;
 
-    _clear_tree();
+    _begin_update();
 
     PackedStringArray signal_names = _orchestration->get_custom_signal_names();
     if (!signal_names.is_empty())
     {
         signal_names.sort();
-        for (const String& signal_name : signal_names)
-        {
-            Ref<OScriptSignal> signal = _orchestration->get_custom_signal(signal_name);
 
-            _create_item(_tree->get_root(), signal_name, signal_name, "MemberSignal");
-        }
+        TreeItem* last_item = nullptr;
+        for (const String& signal_name : signal_names)
+            last_item = _update_item(signal_name, _tree->get_root(), last_item, signal_name, signal_name, "MemberSignal");
     }
-
-    if (_tree->get_root()->get_child_count() == 0)
+    else
     {
-        TreeItem* item = _tree->get_root()->create_child();
-        item->set_text(0, "No signals defined");
+        TreeItem* item = _update_item("@empty", _tree->get_root(), nullptr, "No signals defined", "", "");
         item->set_selectable(0, false);
-        return;
     }
 
+    _end_update();
+
+    if (signal_names.is_empty())
+        return;
+
     OrchestratorScriptComponentPanel::update();
 }
 
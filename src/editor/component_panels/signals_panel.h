@@ -27,13 +27,15 @@ class OrchestratorScriptSignalsComponentPanel : public OrchestratorScriptCompone
     enum ContextMenuIds
     {
         CM_RENAME_SIGNAL,
-        CM_REMOVE_SIGNAL
+        CM_REMOVE_SIGNAL,
+        CM_FIND_SIGNAL_REFERENCES
     };
 
 protected:
     //~ Begin OrchestratorScriptViewSection Interface
     String _get_unique_name_prefix() const override { return "NewSignal"; }
     PackedStringArray _get_existing_names() const override;
+    StringName _get_model_changed_signal() const override { return "signals_changed"; }
     String _get_tooltip_text() const override;
     String _get_remove_confirm_text(TreeItem* p_item) const override;
     String _get_item_name() const override { return "Signal"; }
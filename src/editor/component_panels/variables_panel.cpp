@@ -26,76 +26,184 @@
 #include <godot_cpp/classes/input_event_key.hpp>
 #include <godot_cpp/classes/popup_menu.hpp>
 #include <godot_cpp/classes/tree.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 
-void OrchestratorScriptVariablesComponentPanel::_create_variable_item(TreeItem* p_parent, const Ref<OScriptVariable>& p_variable)
+void OrchestratorScriptVariablesComponentPanel::_update_variable_item(TreeItem* p_item, const Ref<OScriptVariable>& p_variable)
 {
-    TreeItem* category = nullptr;
-    for (TreeItem* child = p_parent->get_first_child(); child; child = child->get_next())
+    // Buttons depend on the variable state, so they're always recreated
+    while (p_item->get_button_count(0) > 0)
+        p_item->erase_button(0, 0);
+
+    if (p_variable->is_exported() && p_variable->get_variable_name().begins_with("_"))
     {
-        if (_get_tree_item_name(child).match(p_variable->get_category()))
-        {
-            category = child;
-            break;
-        }
+        int32_t index = p_item->get_button_count(0);
+        p_item->add_button(0, SceneUtils::get_editor_icon("NodeWarning"), 1);
+        p_item->set_button_tooltip_text(0, index, "Variable is exported but defined as private using underscore prefix.");
+        p_item->set_button_disabled(0, index, true);
     }
 
-    if (p_variable->is_grouped_by_category())
+    p_item->add_button(0, SceneUtils::get_class_icon(p_variable->get_variable_type_name()), 2);
+    p_item->set_button_tooltip_text(0, 0, "Change variable type");
+
+    String tooltip;
+    if (!p_variable->get_description().is_empty())
+        tooltip = SceneUtils::create_wrapped_tooltip_text(p_variable->get_variable_name() + "\n\n" + p_variable->get_description());
+    p_item->set_tooltip_text(0, tooltip);
+
+    if (p_variable->is_exported())
     {
-        if (!category)
-        {
-            category = _create_item(p_parent, p_variable->get_category(), p_variable->get_category(), "");
-            category->set_selectable(0, false);
-        }
+        int32_t index = p_item->get_button_count(0);
+        p_item->add_button(0, SceneUtils::get_editor_icon("GuiVisibilityVisible"), 3);
+        p_item->set_button_tooltip_text(0, index, "Variable is exported and visible outside the orchestration.");
+        p_item->set_button_disabled(0, index, false);
     }
-    else
-        category = p_parent;
-
-    TreeItem* item = _create_item(category, p_variable->get_variable_name(), p_variable->get_variable_name(), "MemberProperty");
+    else if (p_variable->is_constant())
+    {
+        String constant_tooltip = "Variable is a constant.";
 
-    if (p_variable->is_exported() && p_variable->get_variable_name().begins_with("_"))
+        int32_t index = p_item->get_button_count(0);
+        p_item->add_button(0, SceneUtils::get_editor_icon("MemberConstant"), 4);
+        p_item->set_button_tooltip_text(0, index, constant_tooltip);
+        p_item->set_button_disabled(0, index, false);
+    }
+    else
     {
-        int32_t index = item->get_button_count(0);
-        item->add_button(0, SceneUtils::get_editor_icon("NodeWarning"), 1);
-        item->set_button_tooltip_text(0, index, "Variable is exported but defined as private using underscore prefix.");
-        item->set_button_disabled(0, index, true);
+        String private_tooltip = "Variable is private and not exported.";
+        if (!p_variable->is_exportable())
+            private_tooltip += "\nType cannot be exported.";
+
+        int32_t index = p_item->get_button_count(0);
+        p_item->add_button(0, SceneUtils::get_editor_icon("GuiVisibilityHidden"), 3);
+        p_item->set_button_tooltip_text(0, index, private_tooltip);
+        p_item->set_button_disabled(0, index, !p_variable->is_exportable());
     }
+}
 
-    item->add_button(0, SceneUtils::get_class_icon(p_variable->get_variable_type_name()), 2);
-    item->set_button_tooltip_text(0, 0, "Change variable type");
+void OrchestratorScriptVariablesComponentPanel::_variable_changed(OScriptVariable* p_variable)
+{
+    const Ref<OScriptVariable> variable(p_variable);
+    if (!variable.is_valid())
+        return;
 
-    if (!p_variable->get_description().is_empty())
+    // Variables not yet in the tree are added by the next update
+    const HashMap<String, TreeItem*>::Iterator E = _items.find(variable->get_variable_name());
+    if (!E)
     {
-        const String tooltip = p_variable->get_variable_name() + "\n\n" + p_variable->get_description();
-        item->set_tooltip_text(0, SceneUtils::create_wrapped_tooltip_text(tooltip));
+        _queue_update();
+        return;
     }
 
-    if (p_variable->is_exported())
+    // Changing the category moves only this variable's item
+    const String* placed = _placed_categories.getptr(variable->get_variable_name());
+    if (!placed || *placed != _get_category_key(variable))
     {
-        int32_t index = item->get_button_count(0);
-        item->add_button(0, SceneUtils::get_editor_icon("GuiVisibilityVisible"), 3);
-        item->set_button_tooltip_text(0, index, "Variable is exported and visible outside the orchestration.");
-        item->set_button_disabled(0, index, false);
+        _place_variable_item(variable);
+        return;
     }
-    else if (p_variable->is_constant())
+
+    _update_variable_item(E->value, variable);
+}
+
+String OrchestratorScriptVariablesComponentPanel::_get_category_key(const Ref<OScriptVariable>& p_variable)
+{
+    return p_variable->is_grouped_by_category() ? "@category/" + p_variable->get_category() : String();
+}
+
+bool OrchestratorScriptVariablesComponentPanel::_is_category_item(TreeItem* p_item)
+{
+    return String(p_item->get_meta("__key", String())).begins_with("@category/");
+}
+
+void OrchestratorScriptVariablesComponentPanel::_place_variable_item(const Ref<OScriptVariable>& p_variable)
+{
+    const String variable_name = p_variable->get_variable_name();
+    const String category_key = _get_category_key(p_variable);
+
+    String previous_category_key;
+    if (const String* placed = _placed_categories.getptr(variable_name))
+        previous_category_key = *placed;
+
+    const HashMap<String, TreeItem*>::Iterator E = _items.find(variable_name);
+    const TreeItem* existing = E ? E->value : nullptr;
+
+    // Categories precede uncategorized variables, and both are kept in the order of the full update,
+    // so an item is positioned by scanning its siblings rather than sorting all variables.
+    TreeItem* root = _tree->get_root();
+    TreeItem* parent = root;
+    TreeItem* after = nullptr;
+    if (!category_key.is_empty())
     {
-        String tooltip = "Variable is a constant.";
+        TreeItem* category = _items.has(category_key) ? _items[category_key] : nullptr;
+        if (!category)
+        {
+            const String category_sort_name = p_variable->get_category().to_lower();
+            for (TreeItem* child = root->get_first_child(); child && _is_category_item(child); child = child->get_next())
+            {
+                if (child->get_text(0).to_lower() > category_sort_name)
+                    break;
+                after = child;
+            }
+
+            category = _update_item(category_key, root, after, p_variable->get_category(), p_variable->get_category(), "");
+            category->set_selectable(0, false);
+        }
 
-        int32_t index = item->get_button_count(0);
-        item->add_button(0, SceneUtils::get_editor_icon("MemberConstant"), 4);
-        item->set_button_tooltip_text(0, index, tooltip);
-        item->set_button_disabled(0, index, false);
+        parent = category;
+        after = nullptr;
+
+        const String sort_name = variable_name.to_lower();
+        for (TreeItem* child = category->get_first_child(); child; child = child->get_next())
+        {
+            if (child == existing)
+                continue;
+            if (_get_tree_item_name(child).to_lower() > sort_name)
+                break;
+            after = child;
+        }
     }
     else
     {
-        String tooltip = "Variable is private and not exported.";
-        if (!p_variable->is_exportable())
-            tooltip += "\nType cannot be exported.";
-
-        int32_t index = item->get_button_count(0);
-        item->add_button(0, SceneUtils::get_editor_icon("GuiVisibilityHidden"), 3);
-        item->set_button_tooltip_text(0, index, tooltip);
-        item->set_button_disabled(0, index, !p_variable->is_exportable());
+        for (TreeItem* child = root->get_first_child(); child; child = child->get_next())
+        {
+            if (child == existing)
+                continue;
+            if (!_is_category_item(child) && _get_tree_item_name(child) > variable_name)
+                break;
+            after = child;
+        }
     }
+
+    TreeItem* item = _update_item(variable_name, parent, after, variable_name, variable_name, "MemberProperty");
+    _update_variable_item(item, p_variable);
+
+    _placed_categories[variable_name] = category_key;
+    _connect_variable(p_variable);
+
+    if (previous_category_key != category_key)
+        _remove_empty_category(previous_category_key);
+}
+
+void OrchestratorScriptVariablesComponentPanel::_remove_variable_item(const String& p_variable_name)
+{
+    const HashMap<String, String>::Iterator E = _placed_categories.find(p_variable_name);
+    if (!E)
+        return;
+
+    const String category_key = E->value;
+    _placed_categories.remove(E);
+
+    _remove_item(p_variable_name);
+    _remove_empty_category(category_key);
+}
+
+void OrchestratorScriptVariablesComponentPanel::_remove_empty_category(const String& p_category_key)
+{
+    if (p_category_key.is_empty())
+        return;
+
+    const HashMap<String, TreeItem*>::Iterator E = _items.find(p_category_key);
+    if (E && E->value->get_child_count() == 0)
+        _remove_item(p_category_key);
 }
 
 PackedStringArray OrchestratorScriptVariablesComponentPanel::_get_existing_names() const
@@ -120,6 +228,7 @@ bool OrchestratorScriptVariablesComponentPanel::_populate_context_menu(TreeItem*
 {
     _context_menu->add_icon_item(SceneUtils::get_editor_icon("Rename"), "Rename", CM_RENAME_VARIABLE, KEY_F2);
     _context_menu->add_icon_item(SceneUtils::get_editor_icon("Remove"), "Remove", CM_REMOVE_VARIABLE, KEY_DELETE);
+    _context_menu->add_icon_item(SceneUtils::get_editor_icon("Search"), "Find References", CM_FIND_VARIABLE_REFERENCES);
     return true;
 }
 
@@ -133,6 +242,12 @@ void OrchestratorScriptVariablesComponentPanel::_handle_context_menu(int p_id)
         case CM_REMOVE_VARIABLE:
             _confirm_removal(_tree->get_selected());
             break;
+        case CM_FIND_VARIABLE_REFERENCES:
+        {
+            const String name = _get_tree_item_name(_tree->get_selected());
+            _show_references("variable", name, _orchestration->get_variable_references(name));
+            break;
+        }
     }
 }
 
@@ -201,7 +316,7 @@ void OrchestratorScriptVariablesComponentPanel::_handle_button_clicked(TreeItem*
     {
         // Visibility changed on variable
         variable->set_exported(!variable->is_exported());
-        update();
+        _update_variable_item(p_item, variable);
     }
 }
 
@@ -236,20 +351,89 @@ void OrchestratorScriptVariablesComponentPanel::_handle_tree_gui_input(const Ref
     }
 }
 
+void OrchestratorScriptVariablesComponentPanel::_connect_variable(const Ref<OScriptVariable>& p_variable)
+{
+    if (_connected_variables.has(p_variable))
+        return;
+
+    // The variable is referenced while connected, so the bound pointer remains valid
+    OCONNECT(p_variable, "changed", callable_mp(this, &OrchestratorScriptVariablesComponentPanel::_variable_changed).bind(p_variable.ptr()));
+    _connected_variables.insert(p_variable);
+}
+
+void OrchestratorScriptVariablesComponentPanel::_disconnect_removed_variables()
+{
+    LocalVector<Ref<OScriptVariable>> removed;
+    for (const Ref<OScriptVariable>& variable : _connected_variables)
+    {
+        // Renamed variables are the same object under a new name
+        if (_orchestration->get_variable(variable->get_variable_name()) != variable)
+            removed.push_back(variable);
+    }
+
+    for (const Ref<OScriptVariable>& variable : removed)
+    {
+        ODISCONNECT(variable, "changed", callable_mp(this, &OrchestratorScriptVariablesComponentPanel::_variable_changed).bind(variable.ptr()));
+        _connected_variables.erase(variable);
+    }
+}
+
+void OrchestratorScriptVariablesComponentPanel::_update_changed_variables(const PackedStringArray& p_variable_names)
+{
+    HashSet<String> names;
+    for (const String& variable_name : p_variable_names)
+        names.insert(variable_name);
+
+    // Renamed items are re-keyed when edited, so the old name only releases its placement
+    LocalVector<String> removed;
+    for (const KeyValue<String, String>& E : _placed_categories)
+        if (!names.has(E.key))
+            removed.push_back(E.key);
+
+    for (const String& variable_name : removed)
+        _remove_variable_item(variable_name);
+
+    if (p_variable_names.is_empty())
+    {
+        TreeItem* item = _update_item("@empty", _tree->get_root(), nullptr, "No variables defined", "", "");
+        item->set_selectable(0, false);
+        return;
+    }
+
+    _remove_item("@empty");
+
+    for (const String& variable_name : p_variable_names)
+    {
+        const Ref<OScriptVariable> variable = _orchestration->get_variable(variable_name);
+        const String* placed = _placed_categories.getptr(variable_name);
+        if (!placed || !_items.has(variable_name) || *placed != _get_category_key(variable))
+            _place_variable_item(variable);
+    }
+}
+
 void OrchestratorScriptVariablesComponentPanel::update()
 {
     if (_update_blocked)
         return;
 
-    Callable callback = callable_mp(this, &OrchestratorScriptVariablesComponentPanel::_update_variables);
+    PackedStringArray variable_names = _orchestration->get_variable_names();
+    _disconnect_removed_variables();
 
-    // Make sure all variables are disconnected
-    for (const Ref<OScriptVariable>& variable : _orchestration->get_variables())
-        ODISCONNECT(variable, "changed", callback);
+    // Once populated, only variables that were added, removed, renamed, or moved between categories
+    // are placed, the remaining items keep their position and are updated by their own changes.
+    if (!_placed_categories.is_empty())
+    {
+        _update_changed_variables(variable_names);
 
-    _clear_tree();
+        if (variable_names.is_empty())
+            return;
+
+        OrchestratorScriptComponentPanel::update();
+        return;
+    }
+
+    _begin_update();
 
-    PackedStringArray variable_names = _orchestration->get_variable_names();
     if (!variable_names.is_empty())
     {
         HashMap<String, Ref<OScriptVariable>> categorized;
@@ -283,35 +467,52 @@ void OrchestratorScriptVariablesComponentPanel::update()
         sorted_uncategorized_names.sort();
 
         TreeItem* root = _tree->get_root();
+        TreeItem* last_root_item = nullptr;
+        TreeItem* category = nullptr;
+        TreeItem* last_category_item = nullptr;
         for (const String& sort_categorized_name : sorted_categorized_names)
         {
             const String variable_name = categorized_names[sort_categorized_name];
             const Ref<OScriptVariable>& variable = categorized[variable_name];
 
-            if (variable.is_valid())
-                OCONNECT(variable, "changed", callback);
+            const String category_key = _get_category_key(variable);
+            if (!category || String(category->get_meta("__key")) != category_key)
+            {
+                category = _update_item(category_key, root, last_root_item, variable->get_category(), variable->get_category(), "");
+                category->set_selectable(0, false);
+                last_root_item = category;
+                last_category_item = nullptr;
+            }
+
+            last_category_item = _update_item(variable_name, category, last_category_item, variable_name, variable_name, "MemberProperty");
+            _update_variable_item(last_category_item, variable);
 
-            _create_variable_item(root, variable);
+            _placed_categories[variable_name] = category_key;
+            _connect_variable(variable);
         }
 
         for (const String& sort_uncategorized_name : sorted_uncategorized_names)
         {
             const Ref<OScriptVariable>& variable = uncategorized[sort_uncategorized_name];
-            if (variable.is_valid())
-                OCONNECT(variable, "changed", callback);
 
-            _create_variable_item(root, variable);
+            last_root_item = _update_item(sort_uncategorized_name, root, last_root_item, sort_uncategorized_name, sort_uncategorized_name, "MemberProperty");
+            _update_variable_item(last_root_item, variable);
+
+            _placed_categories[sort_uncategorized_name] = String();
+            _connect_variable(variable);
         }
     }
-
-    if (_tree->get_root()->get_child_count() == 0)
+    else
     {
-        TreeItem* item = _tree->get_root()->create_child();
-        item->set_text(0, "No variables defined");
+        TreeItem* item = _update_item("@empty", _tree->get_root(), nullptr, "No variables defined", "", "");
         item->set_selectable(0, false);
-        return;
     }
 
+    _end_update();
+
+    if (variable_names.is_empty())
+        return;
+
     OrchestratorScriptComponentPanel::update();
 }
 
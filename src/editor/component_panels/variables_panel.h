@@ -19,6 +19,8 @@
 
 #include "editor/component_panels/component_panel.h"
 
+#include <godot_cpp/templates/hash_set.hpp>
+
 class OrchestratorScriptVariablesComponentPanel : public OrchestratorScriptComponentPanel
 {
     GDCLASS(OrchestratorScriptVariablesComponentPanel, OrchestratorScriptComponentPanel);
@@ -27,15 +29,18 @@ class OrchestratorScriptVariablesComponentPanel : public OrchestratorScriptCompo
     enum ContextMenuIds
     {
         CM_RENAME_VARIABLE,
-        CM_REMOVE_VARIABLE
+        CM_REMOVE_VARIABLE,
+        CM_FIND_VARIABLE_REFERENCES
     };
 
-    void _update_variables() { update(); }
+    HashSet<Ref<OScriptVariable>> _connected_variables;  //! Variables whose changes update their tree item
+    HashMap<String, String> _placed_categories;          //! Category key each variable's item is placed under, by name
 
 protected:
     //~ Begin OrchestratorScriptViewSection Interface
     String _get_unique_name_prefix() const override { return "NewVar"; }
     PackedStringArray _get_existing_names() const override;
+    StringName _get_model_changed_signal() const override { return "variables_changed"; }
     String _get_tooltip_text() const override;
     String _get_remove_confirm_text(TreeItem* p_item) const override;
     String _get_item_name() const override { return "Variable"; }
@@ -51,7 +56,47 @@ protected:
     void _handle_tree_gui_input(const Ref<InputEvent>& p_event, TreeItem* p_item) override;
     //~ End OrchestratorScriptViewSection Interface
 
-    void _create_variable_item(TreeItem* p_parent, const Ref<OScriptVariable>& p_variable);
+    /// Updates the tree item's buttons and tooltip from the variable's state
+    /// @param p_item the tree item
+    /// @param p_variable the variable
+    void _update_variable_item(TreeItem* p_item, const Ref<OScriptVariable>& p_variable);
+
+    /// Called when a variable changes, updating only its tree item when possible
+    /// @param p_variable the variable that changed
+    void _variable_changed(OScriptVariable* p_variable);
+
+    /// Get the tree item key for the variable's category
+    /// @param p_variable the variable
+    /// @return the category key, or an empty string if the variable is not grouped by category
+    static String _get_category_key(const Ref<OScriptVariable>& p_variable);
+
+    /// Check whether the tree item is a category
+    /// @param p_item the tree item
+    /// @return true if the item groups variables by category, false otherwise
+    static bool _is_category_item(TreeItem* p_item);
+
+    /// Places the variable's tree item in sorted order within its category, creating it if needed
+    /// @param p_variable the variable
+    void _place_variable_item(const Ref<OScriptVariable>& p_variable);
+
+    /// Removes the variable's tree item, and its category when left empty
+    /// @param p_variable_name the variable name the item was placed under
+    void _remove_variable_item(const String& p_variable_name);
+
+    /// Removes the category's tree item if it has no variables
+    /// @param p_category_key the category key, may be empty
+    void _remove_empty_category(const String& p_category_key);
+
+    /// Adds, removes, and moves only the tree items of variables that changed since the last update
+    /// @param p_variable_names the orchestration's variable names
+    void _update_changed_variables(const PackedStringArray& p_variable_names);
+
+    /// Connects to the variable's changes, if not already connected
+    /// @param p_variable the variable
+    void _connect_variable(const Ref<OScriptVariable>& p_variable);
+
+    /// Disconnects from variables that are no longer in the orchestration
+    void _disconnect_removed_variables();
 
     /// Default constructor
     OrchestratorScriptVariablesComponentPanel() = default;
@@ -31,6 +31,7 @@
 #include "editor/graph/graph_node_pin.h"
 #include "editor/graph/graph_node_spawner.h"
 #include "editor/graph/nodes/graph_node_comment.h"
+#include "editor/plugins/orchestrator_editor_debugger_plugin.h"
 #include "nodes/graph_node_factory.h"
 #include "script/language.h"
 #include "script/nodes/script_nodes.h"
@@ -56,8 +57,12 @@
 #include <godot_cpp/classes/script_editor.hpp>
 #include <godot_cpp/classes/style_box_flat.hpp>
 #include <godot_cpp/classes/theme.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/tree_item.hpp>
 #include <godot_cpp/classes/tween.hpp>
 #include <godot_cpp/classes/v_separator.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/sort_array.hpp>
 
 OrchestratorGraphEdit::Clipboard* OrchestratorGraphEdit::_clipboard = nullptr;
 
@@ -178,6 +183,15 @@ void OrchestratorGraphEdit::_notification(int p_what)
         _drag_hint_timer->connect("timeout", callable_mp(this, &OrchestratorGraphEdit::_hide_drag_hint));
         add_child(_drag_hint_timer);
 
+        _population_progress = memnew(ProgressBar);
+        _population_progress->set_anchor(SIDE_LEFT, .35f);
+        _population_progress->set_anchor(SIDE_RIGHT, .65f);
+        _population_progress->set_anchor_and_offset(SIDE_TOP, ANCHOR_END, -40);
+        _population_progress->set_anchor_and_offset(SIDE_BOTTOM, ANCHOR_END, -20);
+        _population_progress->set_mouse_filter(MOUSE_FILTER_IGNORE);
+        _population_progress->hide();
+        add_child(_population_progress);
+
         _theme_update_timer = memnew(Timer);
         _theme_update_timer->set_wait_time(.5);
         _theme_update_timer->set_one_shot(true);
@@ -227,6 +241,48 @@ void OrchestratorGraphEdit::_notification(int p_what)
         validate_and_build->connect("pressed", callable_mp(this, &OrchestratorGraphEdit::_on_validate_and_build));
         get_menu_hbox()->add_child(validate_and_build);
 
+        #if GODOT_VERSION >= 0x040300
+        _heatmap_button = memnew(Button);
+        _heatmap_button->set_text("Heatmap");
+        _heatmap_button->set_button_icon(SceneUtils::get_editor_icon("Gradient"));
+        _heatmap_button->set_tooltip_text("Shows how often nodes execute, and for how long, in the running game");
+        _heatmap_button->set_toggle_mode(true);
+        _heatmap_button->set_focus_mode(FOCUS_NONE);
+        _heatmap_button->connect("toggled", callable_mp(this, &OrchestratorGraphEdit::_on_heatmap_toggled));
+        get_menu_hbox()->add_child(_heatmap_button);
+
+        _heatmap_tree = memnew(Tree);
+        _heatmap_tree->set_columns(3);
+        _heatmap_tree->set_column_titles_visible(true);
+        _heatmap_tree->set_column_title(0, "Node");
+        _heatmap_tree->set_column_title(1, "Calls");
+        _heatmap_tree->set_column_title(2, "Time (ms)");
+        _heatmap_tree->set_column_expand(1, false);
+        _heatmap_tree->set_column_expand(2, false);
+        _heatmap_tree->set_column_custom_minimum_width(1, 70);
+        _heatmap_tree->set_column_custom_minimum_width(2, 80);
+        _heatmap_tree->set_hide_root(true);
+        _heatmap_tree->set_custom_minimum_size(Vector2(320, 220));
+        _heatmap_tree->connect("column_title_clicked", callable_mp(this, &OrchestratorGraphEdit::_on_heatmap_column_clicked));
+        _heatmap_tree->connect("item_activated", callable_mp(this, &OrchestratorGraphEdit::_on_heatmap_item_activated));
+
+        _heatmap_panel = memnew(PanelContainer);
+        _heatmap_panel->set_anchors_and_offsets_preset(PRESET_TOP_RIGHT);
+        _heatmap_panel->set_grow_direction_preset(PRESET_TOP_RIGHT);
+        _heatmap_panel->set_offset(SIDE_TOP, 50);
+        _heatmap_panel->set_offset(SIDE_RIGHT, -10);
+        _heatmap_panel->add_child(_heatmap_tree);
+        _heatmap_panel->hide();
+        add_child(_heatmap_panel);
+
+        if (OrchestratorEditorDebuggerPlugin* debugger = OrchestratorEditorDebuggerPlugin::get_singleton())
+        {
+            debugger->connect("heatmap_toggled", callable_mp(this, &OrchestratorGraphEdit::_on_heatmap_state_changed));
+            debugger->connect("heatmap_updated", callable_mp(this, &OrchestratorGraphEdit::_update_heatmap));
+            _on_heatmap_state_changed(debugger->is_heatmap_enabled());
+        }
+        #endif
+
         const Ref<Resource> self = get_orchestration()->get_self();
         self->connect("connections_changed", callable_mp(this, &OrchestratorGraphEdit::_on_graph_connections_changed));
         self->connect("changed", callable_mp(this, &OrchestratorGraphEdit::_on_script_changed));
@@ -261,9 +317,23 @@ void OrchestratorGraphEdit::_notification(int p_what)
         ProjectSettings* ps = ProjectSettings::get_singleton();
         ps->connect("settings_changed", callable_mp(this, &OrchestratorGraphEdit::_on_project_settings_changed));
 
-        _synchronize_graph_with_script(_deferred_tween_node == -1);
-        _focus_node(_deferred_tween_node);
-        callable_mp(this, &OrchestratorGraphEdit::_synchronize_graph_knots).call_deferred();
+        _hibernate_timer = memnew(Timer);
+        _hibernate_timer->set_one_shot(true);
+        _hibernate_timer->connect("timeout", callable_mp(this, &OrchestratorGraphEdit::_hibernate));
+        add_child(_hibernate_timer);
+
+        // Tab containers hide inactive tabs after they're added, so only materialize once that settles
+        callable_mp(this, &OrchestratorGraphEdit::_on_visibility_changed).call_deferred();
+    }
+    else if (p_what == NOTIFICATION_VISIBILITY_CHANGED)
+    {
+        if (is_node_ready())
+            _on_visibility_changed();
+    }
+    else if (p_what == NOTIFICATION_PROCESS)
+    {
+        if (_populating)
+            _populate_step();
     }
     else if (p_what == NOTIFICATION_THEME_CHANGED)
     {
@@ -280,7 +350,8 @@ void OrchestratorGraphEdit::_notification(int p_what)
             pc->add_theme_stylebox_override("panel", hbox_panel);
         }
 
-        if (is_visible_in_tree() && is_node_ready())
+        // Nodes still being populated pick up the theme as they're created
+        if (is_visible_in_tree() && is_node_ready() && _materialized && !_populating)
             _synchronize_graph_with_script();
     }
 }
@@ -326,7 +397,7 @@ Vector<Ref<OScriptNode>> OrchestratorGraphEdit::get_selected_script_nodes()
 
 void OrchestratorGraphEdit::focus_node(int p_node_id)
 {
-    if (is_inside_tree() && is_node_ready())
+    if (is_inside_tree() && is_node_ready() && _materialized && !_populating)
         _focus_node(p_node_id);
     else
         _deferred_tween_node = p_node_id;
@@ -342,7 +413,11 @@ void OrchestratorGraphEdit::apply_changes()
     // During save update the graph-specific data points
     _script_graph->set_viewport_offset(get_scroll_offset());
     _script_graph->set_viewport_zoom(get_zoom());
-    _store_connection_knots();
+
+    // Without graph elements, there are no connections to validate the knots against, and while populating
+    // not all connections are attached yet and the knots are only cached once population completes.
+    if (_materialized && !_populating)
+        _store_connection_knots();
 }
 
 void OrchestratorGraphEdit::post_apply_changes()
@@ -975,9 +1050,24 @@ bool OrchestratorGraphEdit::_is_position_valid_for_knot(const Vector2& p_positio
 
 void OrchestratorGraphEdit::_cache_connection_knots()
 {
-    _knots.clear();
+    HashMap<uint64_t, Vector<Ref<KnotPoint>>> knots;
     for (const KeyValue<uint64_t, PackedVector2Array>& E : _script_graph->get_knots())
     {
+        // Reuse unchanged knot points, so that their knot elements can be kept
+        const HashMap<uint64_t, Vector<Ref<KnotPoint>>>::ConstIterator K = _knots.find(E.key);
+        if (K && K->value.size() == E.value.size())
+        {
+            bool unchanged = true;
+            for (int i = 0; i < E.value.size() && unchanged; i++)
+                unchanged = K->value[i]->point == E.value[i];
+
+            if (unchanged)
+            {
+                knots[E.key] = K->value;
+                continue;
+            }
+        }
+
         Vector<Ref<KnotPoint>> points;
         for (const Vector2& point : E.value)
         {
@@ -985,8 +1075,9 @@ void OrchestratorGraphEdit::_cache_connection_knots()
             knot->point = point;
             points.push_back(knot);
         }
-        _knots[E.key] = points;
+        knots[E.key] = points;
     }
+    _knots = knots;
 }
 
 void OrchestratorGraphEdit::_store_connection_knots()
@@ -1076,9 +1167,34 @@ void OrchestratorGraphEdit::_create_connection_knot(const Dictionary& p_connecti
 
     _store_connection_knots();
     _synchronize_graph_knots();
+    _redraw_connection(connection);
+}
 
-    if (_is_43p)
-        _synchronize_graph_connections_with_script();
+void OrchestratorGraphEdit::_redraw_connection(const OScriptConnection& p_connection)
+{
+    // Godot 4.2 redraws all connection lines when any graph element moves.
+    // Godot 4.3 caches connection lines, and only reconnecting invalidates a single line's cache.
+    if (!_is_43p)
+        return;
+
+    const String from_node = itos(p_connection.from_node);
+    const String to_node = itos(p_connection.to_node);
+    if (is_node_connected(from_node, p_connection.from_port, to_node, p_connection.to_port))
+    {
+        disconnect_node(from_node, p_connection.from_port, to_node, p_connection.to_port);
+        connect_node(from_node, p_connection.from_port, to_node, p_connection.to_port);
+    }
+}
+
+void OrchestratorGraphEdit::_on_knot_position_changed(const Vector2& p_position, uint64_t p_connection_id)
+{
+    _redraw_connection(OScriptConnection(p_connection_id));
+}
+
+void OrchestratorGraphEdit::_on_knot_dragged(const Vector2& p_from, const Vector2& p_to)
+{
+    // Knot points are updated in place while dragging, the script graph is only updated once the drag ends
+    _store_connection_knots();
 }
 
 void OrchestratorGraphEdit::_update_theme()
@@ -1281,21 +1397,30 @@ void OrchestratorGraphEdit::_synchronize_graph_with_script(bool p_apply_position
         call_deferred("set_zoom", _script_graph->get_viewport_zoom());
         call_deferred("set_scroll_offset", _script_graph->get_viewport_offset());
     }
+
+    // A full synchronization supersedes any in-progress population
+    if (_populating)
+        _finish_population();
 }
 
 void OrchestratorGraphEdit::_synchronize_graph_connections_with_script()
 {
     // Remove all connections
     clear_connections();
+    _pending_connections.clear();
 
-    // Re-assign connections
+    // Re-assign connections, deferring those whose nodes are not yet populated
     for (const OScriptConnection& E : _script_graph->get_connections())
-        connect_node(itos(E.from_node), E.from_port, itos(E.to_node), E.to_port);
+    {
+        if (_populating && (!has_node(itos(E.from_node)) || !has_node(itos(E.to_node))))
+            _pending_connections.push_back(E);
+        else
+            connect_node(itos(E.from_node), E.from_port, itos(E.to_node), E.to_port);
+    }
 }
 
-void OrchestratorGraphEdit::_synchronize_graph_knots()
+void OrchestratorGraphEdit::_remove_all_knots()
 {
-    // Remove all nodes from the graph.
     List<GraphElement*> removables;
     for (int i = 0; i < get_child_count(); i++)
     {
@@ -1308,9 +1433,242 @@ void OrchestratorGraphEdit::_synchronize_graph_knots()
         remove_child(knot);
         knot->queue_free();
     }
+}
+
+void OrchestratorGraphEdit::_materialize()
+{
+    if (_materialized)
+        return;
+
+    _materialized = true;
+
+    // Graphs that were hibernated retain their own viewport, only newly created graphs apply the stored state
+    const bool apply_position = _deferred_tween_node == -1 && _hibernated_selection.is_empty();
+    _begin_population(apply_position);
+}
+
+void OrchestratorGraphEdit::_hibernate()
+{
+    if (!_materialized || is_visible_in_tree())
+        return;
+
+    // Knots are validated against the live connections, so they must be stored first.
+    // A graph hidden before population completed has neither its knots nor its selection restored yet.
+    if (_populating)
+        _cancel_population();
+    else
+    {
+        _store_connection_knots();
+
+        _hibernated_selection.clear();
+        for_each_graph_node([this](OrchestratorGraphNode* node) {
+            if (node->is_selected())
+                _hibernated_selection.push_back(node->get_script_node_id());
+        });
+    }
+
+    clear_connections();
+    _remove_all_knots();
+    _remove_all_nodes();
+
+    _materialized = false;
+}
+
+void OrchestratorGraphEdit::_on_visibility_changed()
+{
+    if (is_visible_in_tree())
+    {
+        _hibernate_timer->stop();
+        _materialize();
+        return;
+    }
+
+    const int hibernate_after = OrchestratorSettings::get_singleton()->get_setting("ui/graph/hibernate_hidden_graphs_after", 300);
+    if (_materialized && hibernate_after > 0)
+        _hibernate_timer->start(hibernate_after);
+}
+
+void OrchestratorGraphEdit::_begin_population(bool p_apply_position)
+{
+    _cancel_population();
+    _remove_all_nodes();
+
+    _script_graph->sanitize_nodes();
+
+    // Determine the region of the graph that will be visible once the viewport is applied
+    const real_t zoom = p_apply_position ? _script_graph->get_viewport_zoom() : get_zoom();
+    const Vector2 offset = p_apply_position ? _script_graph->get_viewport_offset() : get_scroll_offset();
+    // Before the first layout the graph has no size, assume a typical editor viewport instead
+    Vector2 size = get_size();
+    if (size.x <= 0 || size.y <= 0)
+        size = Vector2(1280, 720);
+
+    Rect2 viewport(offset / zoom, size / zoom);
+    if (_deferred_tween_node != -1 && _script_graph->has_node(_deferred_tween_node))
+        viewport.position = _script_graph->get_node(_deferred_tween_node)->get_position() - viewport.size / 2;
+
+    struct PopulationEntry
+    {
+        Ref<OScriptNode> node;
+        bool visible{ false };
+        real_t distance{ 0 };
+
+        bool operator<(const PopulationEntry& p_other) const
+        {
+            if (visible != p_other.visible)
+                return visible;
+            return distance < p_other.distance;
+        }
+    };
+
+    const Vector2 center = viewport.get_center();
+
+    Vector<PopulationEntry> entries;
+    for (const Ref<OScriptNode>& node : _script_graph->get_nodes())
+    {
+        PopulationEntry entry;
+        entry.node = node;
+        entry.visible = viewport.intersects(Rect2(node->get_position(), node->get_size()));
+        entry.distance = center.distance_squared_to(node->get_position() + node->get_size() / 2);
+        entries.push_back(entry);
+    }
+    entries.sort();
+
+    _population_queue.resize(entries.size());
+    for (int i = 0; i < entries.size(); i++)
+    {
+        _population_queue.set(i, entries[i].node);
+        if (entries[i].visible)
+            _population_visible_count++;
+    }
+
+    _populating = true;
+    _synchronize_graph_connections_with_script();
+
+    if (p_apply_position)
+    {
+        // These must be deferred, don't change.
+        call_deferred("set_zoom", _script_graph->get_viewport_zoom());
+        call_deferred("set_scroll_offset", _script_graph->get_viewport_offset());
+    }
+
+    _populate_step();
+
+    if (_populating)
+    {
+        _population_progress->set_max(_population_queue.size());
+        _population_progress->set_value(_population_index);
+        _population_progress->show();
+        set_process(true);
+    }
+}
+
+void OrchestratorGraphEdit::_populate_step()
+{
+    const int budget_ms = OrchestratorSettings::get_singleton()->get_setting("ui/graph/population_frame_budget_ms", 8);
+    const uint64_t budget = budget_ms > 0 ? static_cast<uint64_t>(budget_ms) * 1000 : UINT64_MAX;
+    const uint64_t start = Time::get_singleton()->get_ticks_usec();
+
+    while (_population_index < _population_queue.size())
+    {
+        // Nodes within the viewport are always created, so the visible region is complete in the first frame
+        if (_population_index >= _population_visible_count && Time::get_singleton()->get_ticks_usec() - start >= budget)
+            break;
+
+        const Ref<OScriptNode>& node = _population_queue[_population_index++];
+
+        // Nodes may have been added or removed since population started
+        if (_script_graph->has_node(node->get_id()) && !has_node(itos(node->get_id())))
+            _synchronize_graph_node(node);
+    }
+
+    _attach_pending_connections();
+
+    if (_population_index < _population_queue.size())
+        _population_progress->set_value(_population_index);
+    else
+        _finish_population();
+}
+
+void OrchestratorGraphEdit::_attach_pending_connections()
+{
+    for (List<OScriptConnection>::Element* E = _pending_connections.front(); E;)
+    {
+        List<OScriptConnection>::Element* next = E->next();
+
+        const OScriptConnection& C = E->get();
+        if (has_node(itos(C.from_node)) && has_node(itos(C.to_node)))
+        {
+            connect_node(itos(C.from_node), C.from_port, itos(C.to_node), C.to_port);
+            E->erase();
+        }
+        E = next;
+    }
+}
+
+void OrchestratorGraphEdit::_finish_population()
+{
+    _cancel_population();
+
+    for (int64_t node_id : _hibernated_selection)
+    {
+        if (OrchestratorGraphNode* node = _get_node_by_id(static_cast<int>(node_id)))
+            node->set_selected(true);
+    }
+    _hibernated_selection.clear();
 
+    _focus_node(_deferred_tween_node);
+    _deferred_tween_node = -1;
+
+    // Cache knots now, a save before the deferred synchronization must not treat them as orphans
     _cache_connection_knots();
 
+    callable_mp(this, &OrchestratorGraphEdit::_synchronize_graph_knots).call_deferred();
+}
+
+void OrchestratorGraphEdit::_cancel_population()
+{
+    if (!_populating)
+        return;
+
+    _populating = false;
+    _population_queue.clear();
+    _population_index = 0;
+    _population_visible_count = 0;
+    _pending_connections.clear();
+
+    set_process(false);
+    _population_progress->hide();
+}
+
+void OrchestratorGraphEdit::_synchronize_graph_knots()
+{
+    if (!_materialized)
+        return;
+
+    _cache_connection_knots();
+
+    // Only knot elements whose knot points are no longer cached are removed
+    HashSet<KnotPoint*> existing;
+    List<GraphElement*> removables;
+    for (int i = 0; i < get_child_count(); i++)
+    {
+        if (OrchestratorGraphKnot* knot = Object::cast_to<OrchestratorGraphKnot>(get_child(i)))
+        {
+            const Vector<Ref<KnotPoint>>* points = _knots.getptr(knot->get_connection().id);
+            if (points && points->has(knot->get_knot()))
+                existing.insert(knot->get_knot().ptr());
+            else
+                removables.push_back(knot);
+        }
+    }
+
+    for (GraphElement* knot : removables)
+    {
+        remove_child(knot);
+        knot->queue_free();
+    }
+
     for (const KeyValue<uint64_t, Vector<Ref<KnotPoint>>>& E : _knots)
     {
         OScriptConnection connection(E.key);
@@ -1322,6 +1680,8 @@ void OrchestratorGraphEdit::_synchronize_graph_knots()
         for (int i = 0; i < E.value.size(); i++)
         {
             const Ref<KnotPoint>& point = E.value[i];
+            if (existing.has(point.ptr()))
+                continue;
 
             OrchestratorGraphKnot* graph_knot = memnew(OrchestratorGraphKnot);
             graph_knot->set_graph(_script_graph);
@@ -1330,9 +1690,8 @@ void OrchestratorGraphEdit::_synchronize_graph_knots()
             graph_knot->set_color(source->get_output_port_color(connection.from_port));
             add_child(graph_knot);
 
-            graph_knot->connect("knot_position_changed", callable_mp_lambda(this, [&](const Vector2& position) {
-                _synchronize_graph_connections_with_script();
-            }));
+            graph_knot->connect("knot_position_changed", callable_mp(this, &OrchestratorGraphEdit::_on_knot_position_changed).bind(connection.id));
+            graph_knot->connect("dragged", callable_mp(this, &OrchestratorGraphEdit::_on_knot_dragged));
             graph_knot->connect("knot_delete_requested", callable_mp_lambda(this, [&](const String& name) {
                _on_delete_nodes_requested(Array::make(name));
             }));
@@ -1835,13 +2194,13 @@ void OrchestratorGraphEdit::_delete_nodes(const PackedStringArray& p_node_names)
         }
     }
 
-    PackedStringArray knot_names;
+    RBSet<uint64_t> knot_connections;
 
     for (const String& node_name : p_node_names)
     {
         if (OrchestratorGraphKnot* knot = _get_by_name<OrchestratorGraphKnot>(node_name))
         {
-            knot_names.push_back(node_name);
+            knot_connections.insert(knot->get_connection().id);
 
             if (knot->is_selected())
                 knot->set_selected(false);
@@ -1876,8 +2235,8 @@ void OrchestratorGraphEdit::_delete_nodes(const PackedStringArray& p_node_names)
     if (!p_node_names.is_empty())
         emit_signal("nodes_changed");
 
-    if (!knot_names.is_empty())
-        _synchronize_graph_connections_with_script();
+    for (const uint64_t connection_id : knot_connections)
+        _redraw_connection(OScriptConnection(connection_id));
 }
 
 void OrchestratorGraphEdit::_on_right_mouse_clicked(const Vector2& p_position)
@@ -1890,8 +2249,12 @@ void OrchestratorGraphEdit::_on_right_mouse_clicked(const Vector2& p_position)
 
 void OrchestratorGraphEdit::_on_graph_node_added(int p_node_id)
 {
-    Ref<OScriptNode> node = _script_graph->get_node(p_node_id);
-    _synchronize_graph_node(node);
+    // Unmaterialized graphs create all nodes when shown
+    if (_materialized)
+    {
+        Ref<OScriptNode> node = _script_graph->get_node(p_node_id);
+        _synchronize_graph_node(node);
+    }
 
     // When node is added to graph, show right-click suggestion
     _status->hide();
@@ -1904,7 +2267,9 @@ void OrchestratorGraphEdit::_on_graph_node_removed(int p_node_id)
         remove_child(node);
         node->queue_free();
     }
-    _synchronize_graph_connections_with_script();
+
+    if (_materialized)
+        _synchronize_graph_connections_with_script();
 
     // When last node is removed from graph, show right-click suggestion
     if (_script_graph->get_nodes().is_empty())
@@ -1913,7 +2278,8 @@ void OrchestratorGraphEdit::_on_graph_node_removed(int p_node_id)
 
 void OrchestratorGraphEdit::_on_graph_connections_changed(const String& p_caller)
 {
-    _synchronize_graph_connections_with_script();
+    if (_materialized)
+        _synchronize_graph_connections_with_script();
 }
 
 void OrchestratorGraphEdit::_on_context_menu_selection(int p_id)
@@ -2301,4 +2667,116 @@ void OrchestratorGraphEdit::_on_grid_style_selected(int p_index)
     const GridPattern pattern = static_cast<GridPattern>(int(_grid_pattern->get_item_metadata(p_index)));
     set_grid_pattern(pattern);
 }
+
+void OrchestratorGraphEdit::_on_heatmap_toggled(bool p_enabled)
+{
+    if (OrchestratorEditorDebuggerPlugin* debugger = OrchestratorEditorDebuggerPlugin::get_singleton())
+        debugger->set_heatmap_enabled(p_enabled);
+}
+
+void OrchestratorGraphEdit::_on_heatmap_state_changed(bool p_enabled)
+{
+    // Sampling is shared by all graphs, so keep every graph's button in sync
+    _heatmap_button->set_pressed_no_signal(p_enabled);
+    _heatmap_panel->set_visible(p_enabled);
+
+    _update_heatmap();
+}
+
+void OrchestratorGraphEdit::_update_heatmap()
+{
+    OrchestratorEditorDebuggerPlugin* debugger = OrchestratorEditorDebuggerPlugin::get_singleton();
+
+    const HashMap<int, OrchestratorEditorDebuggerPlugin::NodeHeat>* samples = nullptr;
+    if (debugger && debugger->is_heatmap_enabled())
+        samples = debugger->get_heatmap(get_orchestration()->get_self()->get_path());
+
+    struct HotNode
+    {
+        OrchestratorGraphNode* node{ nullptr };
+        OrchestratorEditorDebuggerPlugin::NodeHeat heat;
+    };
+
+    struct HotNodeComparator
+    {
+        int column{ 0 };
+
+        bool operator()(const HotNode& p_left, const HotNode& p_right) const
+        {
+            // Names sort ascending, measurements sort hottest first
+            if (column == 0)
+                return p_left.node->get_title().naturalnocasecmp_to(p_right.node->get_title()) < 0;
+            if (column == 1)
+                return p_left.heat.count > p_right.heat.count;
+            return p_left.heat.usec > p_right.heat.usec;
+        }
+    };
+
+    // Intensity is relative to the hottest node in this graph
+    LocalVector<HotNode> hot_nodes;
+    uint64_t max_usec = 0;
+    for_each_graph_node([&](OrchestratorGraphNode* node) {
+        if (samples)
+        {
+            if (const OrchestratorEditorDebuggerPlugin::NodeHeat* heat = samples->getptr(node->get_script_node_id()))
+            {
+                hot_nodes.push_back({ node, *heat });
+                max_usec = MAX(max_usec, heat->usec);
+                return;
+            }
+        }
+        node->set_heat(-1.f);
+    });
+
+    HashMap<StringName, float> heat_by_name;
+    for (const HotNode& hot : hot_nodes)
+    {
+        const float heat = max_usec > 0 ? static_cast<float>(hot.heat.usec) / static_cast<float>(max_usec) : 0.f;
+        hot.node->set_heat(heat);
+        heat_by_name[hot.node->get_name()] = heat;
+    }
+
+    // Wires take the intensity of the node they leave from
+    const TypedArray<Dictionary> connections = get_connection_list();
+    for (int i = 0; i < connections.size(); i++)
+    {
+        const Dictionary& connection = connections[i];
+        const StringName from = connection["from_node"];
+        const HashMap<StringName, float>::ConstIterator E = heat_by_name.find(from);
+        set_connection_activity(from, connection["from_port"], connection["to_node"], connection["to_port"], E ? E->value : 0.f);
+    }
+
+    // Hottest nodes
+    SortArray<HotNode, HotNodeComparator> sorter;
+    sorter.compare.column = _heatmap_sort_column;
+    sorter.sort(hot_nodes.ptr(), hot_nodes.size());
+
+    _heatmap_tree->clear();
+    TreeItem* root = _heatmap_tree->create_item();
+
+    for (const HotNode& hot : hot_nodes)
+    {
+        TreeItem* item = _heatmap_tree->create_item(root);
+        item->set_text(0, hot.node->get_title());
+        item->set_metadata(0, hot.node->get_script_node_id());
+        item->set_text(1, itos(static_cast<int64_t>(hot.heat.count)));
+        item->set_text(2, String::num(static_cast<double>(hot.heat.usec) / 1000.0, 2));
+        item->set_custom_color(2, OrchestratorGraphNode::get_heat_color(heat_by_name[hot.node->get_name()]));
+    }
+}
+
+void OrchestratorGraphEdit::_on_heatmap_column_clicked(int p_column, int p_mouse_button)
+{
+    if (p_mouse_button != MOUSE_BUTTON_LEFT || p_column == _heatmap_sort_column)
+        return;
+
+    _heatmap_sort_column = p_column;
+    _update_heatmap();
+}
+
+void OrchestratorGraphEdit::_on_heatmap_item_activated()
+{
+    if (TreeItem* item = _heatmap_tree->get_selected())
+        _focus_node(item->get_metadata(0));
+}
 #endif
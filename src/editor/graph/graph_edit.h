@@ -30,8 +30,11 @@
 #include <godot_cpp/classes/editor_interface.hpp>
 #include <godot_cpp/classes/graph_edit.hpp>
 #include <godot_cpp/classes/option_button.hpp>
+#include <godot_cpp/classes/panel_container.hpp>
+#include <godot_cpp/classes/progress_bar.hpp>
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/classes/timer.hpp>
+#include <godot_cpp/classes/tree.hpp>
 
 using namespace godot;
 
@@ -127,6 +130,10 @@ class OrchestratorGraphEdit : public GraphEdit
 
     #if GODOT_VERSION >= 0x040300
     OptionButton* _grid_pattern{ nullptr };                //! Grid pattern option button
+    Button* _heatmap_button{ nullptr };                    //! Toggles the node execution heatmap
+    PanelContainer* _heatmap_panel{ nullptr };             //! Lists the hottest nodes
+    Tree* _heatmap_tree{ nullptr };                        //! The hottest nodes, sorted by the selected column
+    int _heatmap_sort_column{ 2 };                         //! The column the hottest nodes are sorted by
     #endif
     Ref<OScriptGraph> _script_graph;                       //! The underlying orchestration script graph
     OrchestratorGraphActionMenu* _action_menu{ nullptr };  //! Actions menu
@@ -138,6 +145,15 @@ class OrchestratorGraphEdit : public GraphEdit
     Label* _drag_hint{ nullptr };                          //! Displays the drag status at the bottom of the graph
     Timer* _drag_hint_timer{ nullptr };                    //! Timer for drag hint messages
     Timer* _theme_update_timer{ nullptr };
+    Timer* _hibernate_timer{ nullptr };                    //! Timer that hibernates the graph while hidden
+    bool _materialized{ false };                           //! Whether the graph elements have been created
+    PackedInt64Array _hibernated_selection;                //! Selected node ids at the time of hibernation
+    bool _populating{ false };                             //! Whether graph nodes are being created progressively
+    Vector<Ref<OScriptNode>> _population_queue;            //! Script nodes to create, nearest to the viewport first
+    int _population_index{ 0 };                            //! Next population queue index to create
+    int _population_visible_count{ 0 };                    //! Queued nodes in the viewport, created without a budget
+    List<OScriptConnection> _pending_connections;          //! Connections waiting on endpoint nodes to be created
+    ProgressBar* _population_progress{ nullptr };          //! Shows the progressive population progress
     Button* _base_type_button{ nullptr };
     Dictionary _hovered_connection;                        //! Hovered connection details
     HashMap<uint64_t, Vector<Ref<KnotPoint>>> _knots;      //! Knots for each graph connection
@@ -326,6 +342,20 @@ private:
     /// @param p_position the position to created the knot
     void _create_connection_knot(const Dictionary& p_connection, const Vector2& p_position);
 
+    /// Redraws the line of a single connection, i.e. after its knots have moved
+    /// @param p_connection the connection
+    void _redraw_connection(const OScriptConnection& p_connection);
+
+    /// Called as a knot moves, redrawing only the knot's connection line
+    /// @param p_position the knot position
+    /// @param p_connection_id the knot's connection id
+    void _on_knot_position_changed(const Vector2& p_position, uint64_t p_connection_id);
+
+    /// Called when a knot drag ends, updating the script graph knots
+    /// @param p_from the position the drag started from
+    /// @param p_to the position the drag ended at
+    void _on_knot_dragged(const Vector2& p_from, const Vector2& p_to);
+
     /// Updates the GraphEdit theme
     void _update_theme();
 
@@ -363,6 +393,36 @@ private:
     /// Synchronizes the graph knots
     void _synchronize_graph_knots();
 
+    /// Helper method that removes all knots from the graph.
+    void _remove_all_knots();
+
+    /// Creates the graph elements for the script graph, if not already created.
+    /// Graphs are materialized the first time they're shown, so hidden tabs stay lightweight.
+    void _materialize();
+
+    /// Frees the graph elements of a hidden graph, keeping the viewport and selection state.
+    void _hibernate();
+
+    /// Called when the graph's visibility changes to materialize or schedule hibernation
+    void _on_visibility_changed();
+
+    /// Starts creating the graph elements progressively, ordered by distance from the viewport.
+    /// Nodes within the viewport are created immediately, the rest within a per-frame time budget.
+    /// @param p_apply_position repositions the graph based on the stored state
+    void _begin_population(bool p_apply_position);
+
+    /// Creates the next slice of graph nodes and any connections whose endpoints now exist
+    void _populate_step();
+
+    /// Connects any pending connections where both endpoint nodes exist
+    void _attach_pending_connections();
+
+    /// Completes population, restoring the selection, focus, and knots
+    void _finish_population();
+
+    /// Stops population without completing it
+    void _cancel_population();
+
     /// Remove all knots related to the specific connection id
     /// @param p_connection_id
     void _remove_connection_knots(uint64_t p_connection_id);
@@ -517,6 +577,25 @@ private:
     /// Dispatched when a grid style option is selected
     /// @param p_index the selected item index
     void _on_grid_style_selected(int p_index);
+
+    /// Dispatched when the user toggles the heatmap button
+    /// @param p_enabled whether the heatmap is enabled
+    void _on_heatmap_toggled(bool p_enabled);
+
+    /// Dispatched when the debugger enables or disables node execution sampling
+    /// @param p_enabled whether sampling is enabled
+    void _on_heatmap_state_changed(bool p_enabled);
+
+    /// Applies the latest node samples as overlays on nodes and wires, and refreshes the hottest nodes
+    void _update_heatmap();
+
+    /// Dispatched when a hottest nodes column title is clicked, sorting by that column
+    /// @param p_column the column
+    /// @param p_mouse_button the mouse button
+    void _on_heatmap_column_clicked(int p_column, int p_mouse_button);
+
+    /// Dispatched when a hottest node is activated, focusing the node
+    void _on_heatmap_item_activated();
     #endif
 };
 
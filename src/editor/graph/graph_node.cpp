@@ -102,6 +102,30 @@ void OrchestratorGraphNode::_notification(int p_what)
         // Update the pin display upon entering
         _update_pins();
     }
+    else if (p_what == NOTIFICATION_DRAW)
+    {
+        if (_heat >= 0.f)
+        {
+            const Rect2 rect(Vector2(), get_size());
+            const Color color = get_heat_color(_heat);
+            draw_rect(rect, Color(color, 0.15f));
+            draw_rect(rect, color, false, 3.f);
+        }
+    }
+}
+
+void OrchestratorGraphNode::set_heat(float p_heat)
+{
+    if (Math::is_equal_approx(_heat, p_heat))
+        return;
+
+    _heat = p_heat;
+    queue_redraw();
+}
+
+Color OrchestratorGraphNode::get_heat_color(float p_heat)
+{
+    return Color(0.2f, 0.45f, 1.f).lerp(Color(1.f, 0.2f, 0.1f), CLAMP(p_heat, 0.f, 1.f));
 }
 
 void OrchestratorGraphNode::_gui_input(const Ref<InputEvent>& p_event)
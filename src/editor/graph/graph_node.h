@@ -80,6 +80,7 @@ class OrchestratorGraphNode : public GraphNode
     List<Ref<OScriptAction>> _context_actions;  //! Context menu actions
     PopupMenu* _context_menu{ nullptr };        //! The node's context menu
     HBoxContainer* _indicators{ nullptr };      //! Container for indicators
+    float _heat{ -1.f };                        //! Heatmap intensity, negative when not shown
 
 protected:
     OrchestratorGraphNode() = default;
@@ -115,6 +116,15 @@ public:
     /// Toggles breakpoint on this node
     void toggle_breakpoint() { _handle_context_menu(CM_TOGGLE_BREAKPOINT); }
 
+    /// Set the node's heatmap intensity, drawn as a colored overlay
+    /// @param p_heat the intensity between 0 and 1, or a negative value to remove the overlay
+    void set_heat(float p_heat);
+
+    /// Get the heatmap overlay color for an intensity
+    /// @param p_heat the intensity between 0 and 1
+    /// @return the overlay color
+    static Color get_heat_color(float p_heat);
+
     /// Get the graph node input pin at a given port
     /// @param p_port the port or slot index
     /// @return the editor graph node pin, or null if not found
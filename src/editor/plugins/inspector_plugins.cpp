@@ -74,29 +74,27 @@ void OrchestratorEditorInspectorPluginSignal::_move_down(int p_index, const Ref<
 
 void OrchestratorEditorInspectorPluginSignal::_swap(int p_index, int p_pin_offset, int p_argument_offset, const Ref<OScriptSignal>& p_signal)
 {
-    for (const Ref<OScriptGraph>& graph : p_signal->get_orchestration()->get_graphs())
+    Orchestration* orchestration = p_signal->get_orchestration();
+    for (const int node_id : orchestration->get_signal_references(p_signal->get_signal_name()))
     {
-        for (const Ref<OScriptNode>& node : graph->get_nodes())
+        Ref<OScriptNodeEmitSignal> signal_node = orchestration->get_node(node_id);
+        if (signal_node.is_valid() && signal_node->get_signal() == p_signal)
         {
-            Ref<OScriptNodeEmitSignal> signal_node = node;
-            if (signal_node.is_valid() && signal_node->get_signal() == p_signal)
-            {
-                // Offset by one because Emit Signal port 0 is the execution port
-                Ref<OScriptNodePin> pin = signal_node->find_pin(p_index + 1, PD_Input);
-                Ref<OScriptNodePin> other_pin = signal_node->find_pin(p_index + p_pin_offset, PD_Input);
+            // Offset by one because Emit Signal port 0 is the execution port
+            Ref<OScriptNodePin> pin = signal_node->find_pin(p_index + 1, PD_Input);
+            Ref<OScriptNodePin> other_pin = signal_node->find_pin(p_index + p_pin_offset, PD_Input);
 
-                Vector<Ref<OScriptNodePin>> pin_sources = pin->get_connections();
-                Vector<Ref<OScriptNodePin>> other_pin_sources = other_pin->get_connections();
+            Vector<Ref<OScriptNodePin>> pin_sources = pin->get_connections();
+            Vector<Ref<OScriptNodePin>> other_pin_sources = other_pin->get_connections();
 
-                pin->unlink_all();
-                other_pin->unlink_all();
+            pin->unlink_all();
+            other_pin->unlink_all();
 
-                for (const Ref<OScriptNodePin>& pin_source : pin_sources)
-                    pin_source->link(other_pin);
+            for (const Ref<OScriptNodePin>& pin_source : pin_sources)
+                pin_source->link(other_pin);
 
-                for (const Ref<OScriptNodePin>& other_pin_source : other_pin_sources)
-                    other_pin_source->link(pin);
-            }
+            for (const Ref<OScriptNodePin>& other_pin_source : other_pin_sources)
+                other_pin_source->link(pin);
         }
     }
 
@@ -16,12 +16,20 @@
 //
 #include "editor/plugins/orchestrator_editor_debugger_plugin.h"
 
+#include "script/vm/node_profiler.h"
+
 #if GODOT_VERSION >= 0x040300
 OrchestratorEditorDebuggerPlugin* OrchestratorEditorDebuggerPlugin::_singleton = nullptr;
 
 void OrchestratorEditorDebuggerPlugin::_session_started(int32_t p_session_id)
 {
     // Session id is 0, when game starts.
+    if (_heatmap_enabled)
+    {
+        const Ref<EditorDebuggerSession> session = get_session(p_session_id);
+        if (session.is_valid())
+            session->toggle_profiler(OScriptNodeProfiler::PROFILER_NAME, true, Array());
+    }
 }
 
 void OrchestratorEditorDebuggerPlugin::_session_stopped(int32_t p_session_id)
@@ -69,6 +77,70 @@ void OrchestratorEditorDebuggerPlugin::_breakpoint_set_in_tree(const Ref<Script>
     emit_signal("breakpoint_set_in_tree", p_script, p_line, p_enabled);
 }
 
+bool OrchestratorEditorDebuggerPlugin::_has_capture(const String& p_capture) const
+{
+    return p_capture == "orchestrator";
+}
+
+bool OrchestratorEditorDebuggerPlugin::_capture(const String& p_message, const Array& p_data, int32_t p_session_id)
+{
+    if (p_message != OScriptNodeProfiler::SNAPSHOT_MESSAGE)
+        return false;
+
+    if (!_heatmap_enabled)
+        return true;
+
+    // Snapshots are cumulative, and replace any previous samples
+    _heatmap.clear();
+    for (int i = 0; i < p_data.size(); i++)
+    {
+        const Array entry = p_data[i];
+        ERR_CONTINUE_MSG(entry.size() != 4, "Malformed heatmap snapshot");
+
+        const PackedInt32Array ids = entry[1];
+        const PackedInt64Array counts = entry[2];
+        const PackedInt64Array usecs = entry[3];
+        ERR_CONTINUE_MSG(counts.size() != ids.size() || usecs.size() != ids.size(), "Malformed heatmap snapshot");
+
+        HashMap<int, NodeHeat>& nodes = _heatmap[String(entry[0])];
+        for (int64_t j = 0; j < ids.size(); j++)
+        {
+            NodeHeat& heat = nodes[ids[j]];
+            heat.count = counts[j];
+            heat.usec = usecs[j];
+        }
+    }
+
+    emit_signal("heatmap_updated");
+    return true;
+}
+
+void OrchestratorEditorDebuggerPlugin::set_heatmap_enabled(bool p_enabled)
+{
+    if (_heatmap_enabled == p_enabled)
+        return;
+
+    _heatmap_enabled = p_enabled;
+    _heatmap.clear();
+
+    const TypedArray<EditorDebuggerSession> sessions = get_sessions();
+    for (int i = 0; i < sessions.size(); i++)
+    {
+        const Ref<EditorDebuggerSession> session = sessions[i];
+        if (session.is_valid() && session->is_active())
+            session->toggle_profiler(OScriptNodeProfiler::PROFILER_NAME, p_enabled, Array());
+    }
+
+    emit_signal("heatmap_toggled", p_enabled);
+    emit_signal("heatmap_updated");
+}
+
+const HashMap<int, OrchestratorEditorDebuggerPlugin::NodeHeat>* OrchestratorEditorDebuggerPlugin::get_heatmap(const String& p_path) const
+{
+    const HashMap<String, HashMap<int, NodeHeat>>::ConstIterator E = _heatmap.find(p_path);
+    return E ? &E->value : nullptr;
+}
+
 void OrchestratorEditorDebuggerPlugin::set_breakpoint(const String& p_file, int32_t p_line, bool p_enabled)
 {
     // todo: find a way to pass session id to this call
@@ -82,6 +154,8 @@ void OrchestratorEditorDebuggerPlugin::_bind_methods()
 {
     ADD_SIGNAL(MethodInfo("goto_script_line", PropertyInfo(Variant::OBJECT, "script"), PropertyInfo(Variant::INT, "line")));
     ADD_SIGNAL(MethodInfo("breakpoints_cleared_in_tree"));
+    ADD_SIGNAL(MethodInfo("heatmap_toggled", PropertyInfo(Variant::BOOL, "enabled")));
+    ADD_SIGNAL(MethodInfo("heatmap_updated"));
     ADD_SIGNAL(MethodInfo("breakpoint_set_in_tree", PropertyInfo(Variant::OBJECT, "script"), PropertyInfo(Variant::INT, "line"), PropertyInfo(Variant::BOOL, "enabled")));
 }
 
@@ -33,9 +33,19 @@ class OrchestratorEditorDebuggerPlugin : public EditorDebuggerPlugin
     GDCLASS(OrchestratorEditorDebuggerPlugin, EditorDebuggerPlugin);
     static void _bind_methods();
 
+public:
+    /// Execution statistics for a node, sampled by the running game
+    struct NodeHeat
+    {
+        uint64_t count{ 0 };  //! Number of times the node executed
+        uint64_t usec{ 0 };   //! Cumulative execution time, including nested calls
+    };
+
 protected:
     static OrchestratorEditorDebuggerPlugin* _singleton;  //! Singleton instance
     Ref<EditorDebuggerSession> _current_session;          //! Current debugger session
+    bool _heatmap_enabled{ false };                       //! Whether node execution sampling is enabled
+    HashMap<String, HashMap<int, NodeHeat>> _heatmap;     //! Latest node samples, by script path
 
     //~ Begin Signal Handlers
     void _session_started(int32_t p_session_id);
@@ -50,6 +60,8 @@ public:
     void _goto_script_line(const Ref<Script>& p_script, int p_line) override;
     void _breakpoints_cleared_in_tree() override;
     void _breakpoint_set_in_tree(const Ref<Script>& p_script, int p_line, bool p_enabled) override;
+    bool _has_capture(const String& p_capture) const override;
+    bool _capture(const String& p_message, const Array& p_data, int32_t p_session_id) override;
     //~ End EditorDebuggerPlugin Interface
 
     /// Get the singleton instance for this plugin
@@ -62,6 +74,19 @@ public:
     /// @param p_enabled whether the breakpoint is enabled
     void set_breakpoint(const String& p_file, int32_t p_line, bool p_enabled);
 
+    /// Enables or disables node execution sampling in running games, discarding previous samples
+    /// @param p_enabled whether sampling is enabled
+    void set_heatmap_enabled(bool p_enabled);
+
+    /// Check whether node execution sampling is enabled
+    /// @return true if enabled, false otherwise
+    bool is_heatmap_enabled() const { return _heatmap_enabled; }
+
+    /// Get the latest node samples for a script
+    /// @param p_path the script path
+    /// @return the samples by node id, or <code>nullptr</code> if the script has no samples
+    const HashMap<int, NodeHeat>* get_heatmap(const String& p_path) const;
+
     /// Constructor
     OrchestratorEditorDebuggerPlugin();
 
@@ -16,6 +16,7 @@
 //
 #include "orchestration/orchestration.h"
 
+#include "common/settings.h"
 #include "common/variant_utils.h"
 #include "script/node.h"
 #include "script/nodes/functions/call_script_function.h"
@@ -306,6 +307,8 @@ void Orchestration::post_initialize()
 
     _fix_orphans();
 
+    _rebuild_reference_index();
+
     // Check if upgrades are required
     if (_version < OScriptResourceFormatInstance::FORMAT_VERSION)
     {
@@ -324,6 +327,8 @@ void Orchestration::validate_and_build(BuildLog& p_log)
     // Sanity check
     _fix_orphans();
 
+    _verify_reference_index();
+
     for (const KeyValue<int, Ref<OScriptNode>>& E : _nodes)
         E.value->validate_node_during_build(p_log);
 }
@@ -340,6 +345,8 @@ void Orchestration::add_node(const Ref<OScriptGraph>& p_graph, const Ref<OScript
 
     // Register the node with the script
     _nodes[p_node->get_id()] = p_node;
+    _index_node(p_node);
+    _verify_reference_index();
 
     // Register the node with the graph
     p_graph->add_node(p_node);
@@ -387,7 +394,9 @@ void Orchestration::remove_node(int p_node_id)
     for (const KeyValue<StringName, Ref<OScriptGraph>>& E : _graphs)
         E.value->remove_node(node);
 
+    _unindex_node(p_node_id);
     _nodes.erase(p_node_id);
+    _verify_reference_index();
 }
 
 Ref<OScriptNode> Orchestration::get_node(int p_node_id) const
@@ -404,6 +413,212 @@ Vector<Ref<OScriptNode>> Orchestration::get_nodes() const
     return results;
 }
 
+Orchestration::NodeReferences Orchestration::_get_node_references(const Ref<OScriptNode>& p_node)
+{
+    NodeReferences references;
+    references.node_class = p_node->get_class();
+
+    if (OScriptNodeVariable* variable_node = Object::cast_to<OScriptNodeVariable>(p_node.ptr()))
+    {
+        const Ref<OScriptVariable> variable = variable_node->get_variable();
+        if (variable.is_valid())
+            references.variable = variable->get_variable_name();
+    }
+    else if (OScriptNodeCallScriptFunction* call_node = Object::cast_to<OScriptNodeCallScriptFunction>(p_node.ptr()))
+    {
+        const Ref<OScriptFunction> function = call_node->get_function();
+        if (function.is_valid())
+            references.function = function->get_function_name();
+    }
+    else if (OScriptNodeEmitSignal* signal_node = Object::cast_to<OScriptNodeEmitSignal>(p_node.ptr()))
+    {
+        const Ref<OScriptSignal> signal = signal_node->get_signal();
+        if (signal.is_valid())
+            references.signal = signal->get_signal_name();
+    }
+
+    return references;
+}
+
+void Orchestration::_index_node(const Ref<OScriptNode>& p_node)
+{
+    const NodeReferences references = _get_node_references(p_node);
+
+    const int node_id = p_node->get_id();
+    _class_index[references.node_class].insert(node_id);
+
+    if (!references.variable.is_empty())
+        _variable_references[references.variable].insert(node_id);
+
+    if (!references.function.is_empty())
+        _function_references[references.function].insert(node_id);
+
+    if (!references.signal.is_empty())
+        _signal_references[references.signal].insert(node_id);
+
+    _node_references[node_id] = references;
+}
+
+void Orchestration::_unindex_node(int p_node_id)
+{
+    const HashMap<int, NodeReferences>::Iterator E = _node_references.find(p_node_id);
+    if (!E)
+        return;
+
+    const auto erase_from = [p_node_id](HashMap<StringName, HashSet<int>>& r_index, const StringName& p_key) {
+        if (p_key.is_empty())
+            return;
+
+        if (HashSet<int>* ids = r_index.getptr(p_key))
+        {
+            ids->erase(p_node_id);
+            if (ids->is_empty())
+                r_index.erase(p_key);
+        }
+    };
+
+    erase_from(_class_index, E->value.node_class);
+    erase_from(_variable_references, E->value.variable);
+    erase_from(_function_references, E->value.function);
+    erase_from(_signal_references, E->value.signal);
+
+    _node_references.remove(E);
+}
+
+void Orchestration::_rebuild_reference_index()
+{
+    _node_references.clear();
+    _class_index.clear();
+    _variable_references.clear();
+    _function_references.clear();
+    _signal_references.clear();
+
+    for (const KeyValue<int, Ref<OScriptNode>>& E : _nodes)
+        _index_node(E.value);
+}
+
+void Orchestration::_rename_references(HashMap<StringName, HashSet<int>>& r_index, StringName NodeReferences::*p_member,
+                                       const StringName& p_old_name, const StringName& p_new_name)
+{
+    const HashMap<StringName, HashSet<int>>::Iterator E = r_index.find(p_old_name);
+    if (!E)
+        return;
+
+    const HashSet<int> ids = E->value;
+    r_index.remove(E);
+
+    for (const int node_id : ids)
+    {
+        if (NodeReferences* references = _node_references.getptr(node_id))
+            references->*p_member = p_new_name;
+    }
+
+    r_index[p_new_name] = ids;
+}
+
+Vector<int> Orchestration::_get_references(const HashMap<StringName, HashSet<int>>& p_index, const StringName& p_name)
+{
+    Vector<int> results;
+    if (const HashSet<int>* ids = p_index.getptr(p_name))
+    {
+        for (const int node_id : *ids)
+            results.push_back(node_id);
+    }
+    return results;
+}
+
+void Orchestration::update_node_references(const Ref<OScriptNode>& p_node)
+{
+    ERR_FAIL_COND(p_node.is_null());
+
+    // Nodes are only indexed once registered with the orchestration
+    if (!_nodes.has(p_node->get_id()))
+        return;
+
+    _unindex_node(p_node->get_id());
+    _index_node(p_node);
+}
+
+Vector<int> Orchestration::get_node_ids_by_class(const StringName& p_class_name) const
+{
+    return _get_references(_class_index, p_class_name);
+}
+
+Vector<int> Orchestration::get_variable_references(const StringName& p_name) const
+{
+    return _get_references(_variable_references, p_name);
+}
+
+Vector<int> Orchestration::get_function_references(const StringName& p_name) const
+{
+    return _get_references(_function_references, p_name);
+}
+
+Vector<int> Orchestration::get_signal_references(const StringName& p_name) const
+{
+    return _get_references(_signal_references, p_name);
+}
+
+void Orchestration::_verify_reference_index() const
+{
+    #ifdef DEV_ENABLED
+    // The check is linear in the number of nodes, so it's opt-in even in development builds
+    OrchestratorSettings* settings = OrchestratorSettings::get_singleton();
+    if (settings && settings->get_setting("settings/debug/verify_reference_index", false))
+        DEV_ASSERT(is_reference_index_consistent());
+    #endif
+}
+
+bool Orchestration::is_reference_index_consistent() const
+{
+    if (_node_references.size() != _nodes.size())
+        return false;
+
+    const auto is_indexed = [](const HashMap<StringName, HashSet<int>>& p_index, const StringName& p_key, int p_node_id) {
+        if (p_key.is_empty())
+            return true;
+
+        const HashSet<int>* ids = p_index.getptr(p_key);
+        return ids && ids->has(p_node_id);
+    };
+
+    const auto count_ids = [](const HashMap<StringName, HashSet<int>>& p_index) {
+        uint32_t count = 0;
+        for (const KeyValue<StringName, HashSet<int>>& E : p_index)
+            count += E.value.size();
+        return count;
+    };
+
+    uint32_t variables = 0;
+    uint32_t functions = 0;
+    uint32_t signals = 0;
+    for (const KeyValue<int, Ref<OScriptNode>>& E : _nodes)
+    {
+        const NodeReferences* indexed = _node_references.getptr(E.key);
+        if (!indexed)
+            return false;
+
+        const NodeReferences current = _get_node_references(E.value);
+        if (indexed->node_class != current.node_class || indexed->variable != current.variable
+            || indexed->function != current.function || indexed->signal != current.signal)
+            return false;
+
+        if (!is_indexed(_class_index, current.node_class, E.key) || !is_indexed(_variable_references, current.variable, E.key)
+            || !is_indexed(_function_references, current.function, E.key) || !is_indexed(_signal_references, current.signal, E.key))
+            return false;
+
+        variables += current.variable.is_empty() ? 0 : 1;
+        functions += current.function.is_empty() ? 0 : 1;
+        signals += current.signal.is_empty() ? 0 : 1;
+    }
+
+    // No ids are indexed for nodes that no longer reference the name
+    return count_ids(_class_index) == static_cast<uint32_t>(_nodes.size())
+        && count_ids(_variable_references) == variables
+        && count_ids(_function_references) == functions
+        && count_ids(_signal_references) == signals;
+}
+
 const RBSet<OScriptConnection>& Orchestration::get_connections() const
 {
     return _connections;
@@ -640,14 +855,8 @@ void Orchestration::remove_function(const StringName& p_name)
                 remove_graph(graph->get_graph_name());
         }
 
-        const List<int> node_ids = _get_node_type_node_ids<OScriptNodeCallScriptFunction>();
-        for (int node_id : node_ids)
-        {
-            const Ref<OScriptNodeCallScriptFunction> call_function = get_node(node_id);
-            const Ref<OScriptFunction> called_function = call_function->get_function();
-            if (call_function.is_valid() && called_function->get_function_name().match(function->get_function_name()))
-                remove_node(node_id);
-        }
+        for (const int node_id : get_function_references(function->get_function_name()))
+            remove_node(node_id);
 
         // Find the node for this function and remove it
         if (_nodes.has(function->get_owning_node_id()))
@@ -711,6 +920,8 @@ bool Orchestration::rename_function(const StringName& p_old_name, const StringNa
     _functions.erase(p_old_name);
     _functions[p_new_name] = function;
 
+    _rename_references(_function_references, &NodeReferences::function, p_old_name, p_new_name);
+
     _self->emit_signal("functions_changed");
     return true;
 }
@@ -778,13 +989,8 @@ void Orchestration::remove_variable(const StringName& p_name)
 {
     ERR_FAIL_COND_MSG(!has_variable(p_name), "Cannot remove a variable that does not exist: " + p_name);
 
-    const List<int> node_ids = _get_node_type_node_ids<OScriptNodeVariable>();
-    for (int node_id : node_ids)
-    {
-        const Ref<OScriptNodeVariable> variable = get_node(node_id);
-        if (variable.is_valid() && variable->get_variable()->get_variable_name().match(p_name))
-            remove_node(node_id);
-    }
+    for (const int node_id : get_variable_references(p_name))
+        remove_node(node_id);
 
     _variables.erase(p_name);
 
@@ -812,6 +1018,9 @@ bool Orchestration::rename_variable(const StringName& p_old_name, const StringNa
     ERR_FAIL_COND_V_MSG(has_variable(p_new_name), false, "Cannot rename, a variable already exists with the new name: " + p_new_name);
     ERR_FAIL_COND_V_MSG(!String(p_new_name).is_valid_identifier(), false, "Cannot rename, variable name is not valid: " + p_new_name);
 
+    // Re-key the references first, as renaming notifies the referencing nodes
+    _rename_references(_variable_references, &NodeReferences::variable, p_old_name, p_new_name);
+
     const Ref<OScriptVariable> variable = _variables[p_old_name];
     variable->set_variable_name(p_new_name);
 
@@ -847,13 +1056,7 @@ PackedStringArray Orchestration::get_variable_names() const
 
 bool Orchestration::can_remove_variable(const StringName& p_name) const
 {
-    for (const KeyValue<int, Ref<OScriptNode>>& E : _nodes)
-    {
-        Ref<OScriptNodeVariable> variable = E.value;
-        if (variable.is_valid() && variable->get_variable()->get_variable_name().match(p_name))
-            return false;
-    }
-    return true;
+    return !_variable_references.has(p_name);
 }
 
 Ref<OScriptVariable> Orchestration::promote_to_variable(const Ref<OScriptNodePin>& p_pin)
@@ -911,13 +1114,8 @@ void Orchestration::remove_custom_signal(const StringName& p_name)
 {
     ERR_FAIL_COND_MSG(!has_custom_signal(p_name), "No signal exists with the name: " + p_name);
 
-    const List<int> node_ids = _get_node_type_node_ids<OScriptNodeEmitSignal>();
-    for (int node_id : node_ids)
-    {
-        const Ref<OScriptNodeEmitSignal> signal = get_node(node_id);
-        if (signal.is_valid() && signal->get_signal()->get_signal_name().match(p_name))
-            remove_node(node_id);
-    }
+    for (const int node_id : get_signal_references(p_name))
+        remove_node(node_id);
 
     _signals.erase(p_name);
 
@@ -945,6 +1143,8 @@ bool Orchestration::rename_custom_user_signal(const StringName& p_old_name, cons
     ERR_FAIL_COND_V_MSG(has_custom_signal(p_new_name), false, "A custom signal already exists with the new name: " + p_new_name);
     ERR_FAIL_COND_V_MSG(!String(p_new_name).is_valid_identifier(), false, "The custom signal name is invalid: " + p_new_name);
 
+    _rename_references(_signal_references, &NodeReferences::signal, p_old_name, p_new_name);
+
     const Ref<OScriptSignal> signal = find_custom_signal(p_old_name);
     signal->rename(p_new_name);
 
@@ -980,13 +1180,7 @@ PackedStringArray Orchestration::get_custom_signal_names() const
 
 bool Orchestration::can_remove_custom_signal(const StringName& p_name) const
 {
-    for (const KeyValue<int, Ref<OScriptNode>>& E : _nodes)
-    {
-        const Ref<OScriptNodeEmitSignal> emit_signal_node = E.value;
-        if (emit_signal_node.is_valid() && emit_signal_node->get_signal()->get_signal_name().match(p_name))
-            return false;
-    }
-    return true;
+    return !_signal_references.has(p_name);
 }
 
 Orchestration::Orchestration(Resource* p_self, OrchestrationType p_type)
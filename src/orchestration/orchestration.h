@@ -26,6 +26,7 @@
 #include "script/signals.h"
 #include "script/variable.h"
 
+#include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/templates/rb_set.hpp>
 
 using namespace godot;
@@ -72,6 +73,21 @@ protected:
     Resource* _self;                                       //! Reference to the outer resource type
     uint32_t _version{ 0 };                                //! Orchestration version
 
+    /// The orchestration elements a node references, as recorded in the reference index
+    struct NodeReferences
+    {
+        StringName node_class;  //! The node's class name
+        StringName variable;    //! The referenced variable name, if any
+        StringName function;    //! The called function name, if any
+        StringName signal;      //! The emitted signal name, if any
+    };
+
+    HashMap<int, NodeReferences> _node_references;            //! Indexed references by node id
+    HashMap<StringName, HashSet<int>> _class_index;           //! Node ids by node class name
+    HashMap<StringName, HashSet<int>> _variable_references;   //! Node ids by referenced variable name
+    HashMap<StringName, HashSet<int>> _function_references;   //! Node ids by called function name
+    HashMap<StringName, HashSet<int>> _signal_references;     //! Node ids by emitted signal name
+
     //~ Begin Serialization Interface
     TypedArray<OScriptNode> _get_nodes_internal() const;
     void _set_nodes_internal(const TypedArray<OScriptNode>& p_nodes);
@@ -103,20 +119,40 @@ protected:
     void _disconnect_nodes(int p_source_id, int p_source_port, int p_target_id, int p_target_port);
     //~ End Internal Connection API
 
-    /// Get all unique node ids for a specific node type
-    /// @tparam T the node type
-    /// @return a list of node unique IDs
-    template <typename T>
-    List<int> _get_node_type_node_ids()
-    {
-        List<int> ids;
-        for (const KeyValue<int, Ref<OScriptNode>>& E : _nodes)
-        {
-            if (T* ptr = Object::cast_to<T>(E.value.ptr()))
-                ids.push_back(ptr->get_id());
-        }
-        return ids;
-    }
+    //~ Begin Reference Index Interface
+    /// Get the orchestration elements the node currently references
+    /// @param p_node the node
+    /// @return the node's references
+    static NodeReferences _get_node_references(const Ref<OScriptNode>& p_node);
+
+    /// Asserts that the reference index is consistent, in development builds when enabled in the settings
+    void _verify_reference_index() const;
+
+    /// Adds the node to the reference index
+    /// @param p_node the node
+    void _index_node(const Ref<OScriptNode>& p_node);
+
+    /// Removes the node from the reference index
+    /// @param p_node_id the node unique ID
+    void _unindex_node(int p_node_id);
+
+    /// Rebuilds the reference index for all nodes
+    void _rebuild_reference_index();
+
+    /// Moves the node ids indexed under the old name to the new name
+    /// @param r_index the index
+    /// @param p_member the node references member that records the name
+    /// @param p_old_name the old name
+    /// @param p_new_name the new name
+    void _rename_references(HashMap<StringName, HashSet<int>>& r_index, StringName NodeReferences::*p_member,
+                            const StringName& p_old_name, const StringName& p_new_name);
+
+    /// Get the node ids indexed under the given name
+    /// @param p_index the index
+    /// @param p_name the name
+    /// @return the node ids, may be empty
+    static Vector<int> _get_references(const HashMap<StringName, HashSet<int>>& p_index, const StringName& p_name);
+    //~ End Reference Index Interface
 
 public:
     /// Get the orchestration type
@@ -174,6 +210,36 @@ public:
     Vector<Ref<OScriptNode>> get_nodes() const;
     //~ End Node Interface
 
+    //~ Begin Reference Index Interface
+    /// Updates the node's entries in the reference index, i.e. after the node is reconstructed
+    /// @param p_node the node
+    void update_node_references(const Ref<OScriptNode>& p_node);
+
+    /// Get the nodes of the given class
+    /// @param p_class_name the node class name
+    /// @return the node unique IDs
+    Vector<int> get_node_ids_by_class(const StringName& p_class_name) const;
+
+    /// Get the nodes that get or set the variable
+    /// @param p_name the variable name
+    /// @return the node unique IDs
+    Vector<int> get_variable_references(const StringName& p_name) const;
+
+    /// Get the nodes that call the function
+    /// @param p_name the function name
+    /// @return the node unique IDs
+    Vector<int> get_function_references(const StringName& p_name) const;
+
+    /// Get the nodes that emit the custom signal
+    /// @param p_name the signal name
+    /// @return the node unique IDs
+    Vector<int> get_signal_references(const StringName& p_name) const;
+
+    /// Checks that the reference index matches the references of every node
+    /// @return true if the index is consistent, false otherwise
+    bool is_reference_index_consistent() const;
+    //~ End Reference Index Interface
+
     //~ Begin Connection Interface
     const RBSet<OScriptConnection>& get_connections() const;
     /// @deprecated use OScriptGraph::unlink
@@ -165,11 +165,11 @@ Vector<Ref<OScriptNode>> OScriptFunction::get_return_nodes() const
     const Ref<OScriptGraph> graph = get_function_graph();
     if (graph.is_valid())
     {
-        for (const Ref<OScriptNode>& node : graph->get_nodes())
+        const StringName result_class = OScriptNodeFunctionResult::get_class_static();
+        for (const int node_id : _orchestration->get_node_ids_by_class(result_class))
         {
-            const Ref<OScriptNodeFunctionResult> result = node;
-            if (result.is_valid())
-                results.push_back(result);
+            if (graph->has_node(node_id))
+                results.push_back(_orchestration->get_node(node_id));
         }
     }
     return results;
@@ -0,0 +1,65 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/instances/instance_arena.h"
+
+#include "script/instances/script_instance.h"
+#include "script/vm/variable_layout.h"
+
+static constexpr uint32_t align_up(uint32_t p_value, uint32_t p_alignment)
+{
+    return (p_value + p_alignment - 1) & ~(p_alignment - 1);
+}
+
+OScriptInstanceArena* OScriptInstanceArena::create(uint32_t p_capacity, uint32_t p_typed_size)
+{
+    const uint32_t alignment = OScriptVariableLayout::ALIGNMENT;
+    const uint32_t header_size = align_up(sizeof(OScriptInstanceArena), alignment);
+    const uint32_t instances_size = align_up(p_capacity * sizeof(OScriptInstance), alignment);
+
+    // Over-allocate so that the blocks can be aligned
+    uint8_t* block = static_cast<uint8_t*>(memalloc(header_size + instances_size + p_capacity * p_typed_size + alignment));
+    uint8_t* base = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(block) + alignment - 1) & ~uintptr_t(alignment - 1));
+
+    OScriptInstanceArena* arena = new (base) OScriptInstanceArena();
+    arena->_block = block;
+    arena->_live.init(p_capacity);
+    arena->_capacity = p_capacity;
+    arena->_typed_size = p_typed_size;
+    arena->_instances = base + header_size;
+    arena->_typed = p_typed_size > 0 ? arena->_instances + instances_size : nullptr;
+
+    return arena;
+}
+
+void* OScriptInstanceArena::get_instance_storage(uint32_t p_index) const
+{
+    ERR_FAIL_UNSIGNED_INDEX_V(p_index, _capacity, nullptr);
+    return _instances + p_index * sizeof(OScriptInstance);
+}
+
+void OScriptInstanceArena::destroy(OScriptInstance* p_instance)
+{
+    OScriptInstanceArena* arena = p_instance->_arena;
+    p_instance->~OScriptInstance();
+
+    if (arena->_live.unref())
+    {
+        void* block = arena->_block;
+        arena->~OScriptInstanceArena();
+        memfree(block);
+    }
+}
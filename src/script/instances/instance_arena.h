@@ -0,0 +1,66 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_INSTANCE_ARENA_H
+#define ORCHESTRATOR_SCRIPT_INSTANCE_ARENA_H
+
+#include <godot_cpp/templates/safe_refcount.hpp>
+
+using namespace godot;
+
+/// Forward declarations
+class OScriptInstance;
+
+/// A single allocation holding a batch of script instances and their unboxed variable storage.
+///
+/// Instances created in bulk are constructed in place within the arena rather than allocated one by
+/// one. Each instance is still destroyed individually when its owner is freed, and the arena releases
+/// its allocation once the last of its instances has been destroyed.
+///
+class OScriptInstanceArena
+{
+    SafeRefCount _live;              //! Number of instances still alive in the arena
+    void* _block{ nullptr };         //! The unaligned allocation backing the arena
+    uint32_t _capacity{ 0 };         //! Number of instance slots
+    uint32_t _typed_size{ 0 };       //! Size of each instance's typed block
+    uint8_t* _instances{ nullptr };  //! Start of the instance slots
+    uint8_t* _typed{ nullptr };      //! Start of the typed blocks
+
+    OScriptInstanceArena() = default;
+
+public:
+    /// Allocates an arena
+    /// @param p_capacity the number of instances
+    /// @param p_typed_size the size of each instance's typed variable block
+    /// @return the arena
+    static OScriptInstanceArena* create(uint32_t p_capacity, uint32_t p_typed_size);
+
+    /// Get the storage for an instance
+    /// @param p_index the instance slot
+    /// @return the uninitialized instance storage
+    void* get_instance_storage(uint32_t p_index) const;
+
+    /// Get the typed variable block for an instance
+    /// @param p_index the instance slot
+    /// @return the aligned typed block, <code>nullptr</code> if the script has no typed variables
+    _FORCE_INLINE_ uint8_t* get_typed_storage(uint32_t p_index) const { return _typed ? _typed + p_index * _typed_size : nullptr; }
+
+    /// Destroys an instance constructed in the arena, releasing the arena after its last instance
+    /// @param p_instance the instance
+    static void destroy(OScriptInstance* p_instance);
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_INSTANCE_ARENA_H
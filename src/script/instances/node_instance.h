@@ -23,6 +23,8 @@
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
+#include <atomic>
+
 using namespace godot;
 
 /// Forward declarations
@@ -72,6 +74,7 @@ public:
         STEP_FLAG_NO_ADVANCE = STEP_SHIFT << 2,      //! Don't advance past this node
         STEP_FLAG_END = STEP_SHIFT << 3,             //! Return from function call
         STEP_FLAG_YIELD = STEP_SHIFT << 4,           //! Yield
+        STEP_FLAG_TAIL_CALL = STEP_SHIFT << 5,       //! Return by calling another function with this frame
         FLOW_STACK_PUSHED_BIT = 1 << 30,             //! Must come back here at end of sequence
         FLOW_STACK_MASK = FLOW_STACK_PUSHED_BIT - 1  //! Flow stack mask
     };
@@ -94,6 +97,9 @@ protected:
     int pass_index{ 0 };                                 //! The pass index
     int data_input_pin_count{ 0 };                       //! Number of input data pins
     int data_output_pin_count{ 0 };                      //! Number of output data pins
+    bool tail_call{ false };                             //! Whether the node is a script call in tail position
+    std::atomic<uint64_t> profile_count{ 0 };            //! Executions sampled while the node profiler is enabled
+    std::atomic<uint64_t> profile_usec{ 0 };             //! Cumulative sampled execution time
 
 public:
     /// Get the node instance's node unique id
@@ -112,6 +118,11 @@ public:
     /// @return the output port and bits
     virtual int step(OScriptExecutionContext& p_context) = 0;
 
+    /// Check whether the step reads state from outside the graph, such as engine calls, properties,
+    /// or input. The step's result and outputs are recorded, and substituted when replayed.
+    /// @return true if the step reads external state, false otherwise
+    virtual bool is_external_input() const { return false; }
+
     /// Destructor
     ~OScriptNodeInstance() override;
 };
@@ -18,6 +18,7 @@
 
 #include "common/dictionary_utils.h"
 #include "common/memory_utils.h"
+#include "script/instances/instance_arena.h"
 #include "script/nodes/script_nodes.h"
 #include "script/script.h"
 
@@ -66,7 +67,11 @@ static OScriptInstanceInfo init_script_instance_info()
     };
 
     info.free_func = [](void* p_self) {
-        memdelete(((OScriptInstance*)p_self));
+        OScriptInstance* instance = (OScriptInstance*)p_self;
+        if (instance->_arena)
+            OScriptInstanceArena::destroy(instance);
+        else
+            memdelete(instance);
     };
 
     info.refcount_decremented_func = [](void*) -> GDExtensionBool {
@@ -79,19 +84,25 @@ static OScriptInstanceInfo init_script_instance_info()
 
 const OScriptInstanceInfo OScriptInstance::INSTANCE_INFO = init_script_instance_info();
 
-OScriptInstance::OScriptInstance(const Ref<OScript>& p_script, OScriptLanguage* p_language, Object* p_owner)
+OScriptInstance::OScriptInstance(const Ref<OScript>& p_script, OScriptLanguage* p_language, Object* p_owner,
+                                 OScriptInstanceArena* p_arena, uint8_t* p_typed_storage)
     : _script(p_script)
     , _owner(p_owner)
     , _language(p_language)
+    , _arena(p_arena)
 {
     _vm.set_owner(p_owner);
     _vm.set_script(p_script);
 
-    for (const KeyValue<StringName, Ref<OScriptVariable>>& E : p_script->_variables)
-        _vm.register_variable(E.value);
+    _vm.initialize_variables(p_script->get_variable_layout(), p_typed_storage);
 
     for (const KeyValue<StringName, Ref<OScriptFunction>>& E : p_script->_functions)
         _vm.register_function(E.value);
+
+    _vm.initialize_dispatch(p_script->get_dispatch_table());
+
+    if (p_language->get_execution_recorder()->is_recording())
+        _vm.start_recording(p_language->get_execution_recorder());
 }
 
 OScriptInstance::~OScriptInstance()
@@ -102,32 +113,34 @@ OScriptInstance::~OScriptInstance()
 
 bool OScriptInstance::set(const StringName& p_name, const Variant& p_value, PropertyError* r_err)
 {
-    const String variable_name = _get_variable_name_from_path(p_name);
-
-    OScriptVirtualMachine::Variable* variable = _vm.get_variable(variable_name);
-    if (!variable || !variable->exported)
+    const int index = _vm.get_variable_index(_get_variable_name_from_path(p_name));
+    if (index == -1 || !_vm.get_variable_slot(index).exported)
     {
         if (r_err)
             *r_err = PROP_NOT_FOUND;
         return false;
     }
 
+    if (!_vm.set_variable_value(index, p_value))
+    {
+        if (r_err)
+            *r_err = PROP_WRONG_TYPE;
+        return false;
+    }
+
     if (r_err)
         *r_err = PROP_OK;
 
-    variable->value = p_value;
-
     return true;
 }
 
 bool OScriptInstance::get(const StringName& p_name, Variant& p_value, PropertyError* r_err)
 {
     // First check if we have a member variable
-    const String variable_name = _get_variable_name_from_path(p_name);
-    if (_vm.has_variable(variable_name))
+    const int index = _vm.get_variable_index(_get_variable_name_from_path(p_name));
+    if (index != -1)
     {
-        OScriptVirtualMachine::Variable* variable = _vm.get_variable(variable_name);
-        if (!variable || !variable->exported)
+        if (!_vm.get_variable_slot(index).exported)
         {
             if (r_err)
                 *r_err = PROP_NOT_FOUND;
@@ -137,7 +150,7 @@ bool OScriptInstance::get(const StringName& p_name, Variant& p_value, PropertyEr
         if (r_err)
             *r_err = PROP_OK;
 
-        p_value = variable->value;
+        _vm.get_variable_value(index, p_value);
         return true;
     }
 
@@ -181,8 +194,8 @@ GDExtensionPropertyInfo* OScriptInstance::get_property_list(uint32_t* r_count)
 
 Variant::Type OScriptInstance::get_property_type(const StringName& p_name, bool* r_is_valid) const
 {
-    OScriptVirtualMachine::Variable* variable = _vm.get_variable(_get_variable_name_from_path(p_name));
-    if (!variable)
+    const int index = _vm.get_variable_index(_get_variable_name_from_path(p_name));
+    if (index == -1)
     {
         if (r_is_valid)
             *r_is_valid = false;
@@ -192,7 +205,7 @@ Variant::Type OScriptInstance::get_property_type(const StringName& p_name, bool*
     if (r_is_valid)
         *r_is_valid = true;
 
-    return variable->type;
+    return _vm.get_variable_slot(index).type;
 }
 
 bool OScriptInstance::has_method(const StringName& p_name) const
@@ -244,14 +257,19 @@ bool OScriptInstance::property_get_revert(const StringName& p_name, Variant* r_r
 
 void OScriptInstance::notification(int32_t p_what, bool p_reversed)
 {
-    const Array args = Array::make(p_what, p_reversed);
-    const Variant** argptrs = (const Variant**)alloca(sizeof(Variant*) * args.size());
-    for (int i = 0; i < args.size(); i++)
-        argptrs[i] = &args[i];
+    // Most scripts don't implement notifications, avoid marshalling the arguments for each one
+    const int argument_count = _vm.get_notification_argument_count();
+    if (argument_count < 0)
+        return;
+
+    // The event declares only "what", so "reversed" is passed only to functions that declare it
+    const Variant what = p_what;
+    const Variant reversed = p_reversed;
+    const Variant* argptrs[2] = { &what, &reversed };
 
     GDExtensionCallError error;
     Variant ret;
-    call("_notification", argptrs, args.size(), &ret, &error);
+    call("_notification", argptrs, MIN(argument_count, 2), &ret, &error);
 }
 
 void OScriptInstance::to_string(GDExtensionBool* r_is_valid, String* r_out)
@@ -24,6 +24,7 @@
 using namespace godot;
 
 /// Forward declarations
+class OScriptInstanceArena;
 class OScriptNode;
 class OScriptState;
 
@@ -41,11 +42,14 @@ class OScriptInstance : public OScriptInstanceBase
     friend class OScript;
     friend class OScriptLanguage;
     friend class OScriptState;
+    friend class OScriptExecutionReplayer;
+    friend class OScriptInstanceArena;
 
     Ref<OScript> _script;                       //! The script this instance represents
     Object* _owner{ nullptr };                  //! The owning object of the script
     OScriptLanguage* _language{ nullptr };      //! The language the script represents
     OScriptVirtualMachine _vm;                  //! The virtual machine instance
+    OScriptInstanceArena* _arena{ nullptr };    //! The arena the instance was constructed in, if created in bulk
 
 public:
     /// Defines details about the script instance to be passed to Godot
@@ -55,7 +59,10 @@ public:
     /// @param p_script the orchestrator script this instance represents
     /// @param p_language the language object
     /// @param p_owner the owner of the script instance
-    OScriptInstance(const Ref<OScript>& p_script, OScriptLanguage* p_language, Object* p_owner);
+    /// @param p_arena the arena the instance is constructed in, <code>nullptr</code> if allocated individually
+    /// @param p_typed_storage the typed variable storage from the arena, <code>nullptr</code> to allocate
+    OScriptInstance(const Ref<OScript>& p_script, OScriptLanguage* p_language, Object* p_owner,
+                    OScriptInstanceArena* p_arena = nullptr, uint8_t* p_typed_storage = nullptr);
 
     /// OScriptInstance destructor
     ~OScriptInstance() override;
@@ -25,12 +25,13 @@
 
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 #if GODOT_VERSION >= 0x040300
   #include <godot_cpp/classes/os.hpp>
 #endif
-#ifdef TOOLS_ENABLED
-  #include <godot_cpp/core/mutex_lock.hpp>
-#endif
 
 OScriptLanguage* OScriptLanguage::_singleton = nullptr;
 
@@ -38,6 +39,7 @@ OScriptLanguage::OScriptLanguage()
 {
     _singleton = this;
     lock.instantiate();
+    _node_profiler.instantiate();
 }
 
 OScriptLanguage::~OScriptLanguage()
@@ -58,6 +60,46 @@ OScriptLanguage* OScriptLanguage::get_singleton()
     return _singleton;
 }
 
+void OScriptLanguage::_connect_input_snapshot()
+{
+    if (_input_snapshot_connected || !_input_snapshot.has_actions())
+        return;
+
+    // Input action state is only cached for running games, tool scripts query the Input singleton.
+    if (Engine::get_singleton()->is_editor_hint())
+        return;
+
+    SceneTree* tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+    if (!tree)
+        return;
+
+    tree->connect("physics_frame", callable_mp(this, &OScriptLanguage::_on_physics_frame));
+    tree->connect("process_frame", callable_mp(this, &OScriptLanguage::_on_process_frame));
+    _input_snapshot_connected = true;
+}
+
+void OScriptLanguage::_on_physics_frame()
+{
+    _input_snapshot.refresh(true);
+}
+
+void OScriptLanguage::_on_process_frame()
+{
+    _input_snapshot.refresh(false);
+}
+
+void OScriptLanguage::seed_random(uint64_t p_seed)
+{
+    MutexLock mutex_lock(*lock.ptr());
+    _random.seed(p_seed);
+}
+
+OScriptRandomStream OScriptLanguage::create_random_stream()
+{
+    MutexLock mutex_lock(*lock.ptr());
+    return _random.split();
+}
+
 void OScriptLanguage::_init()
 {
     Logger::info("Initializing OrchestratorScript");
@@ -68,6 +110,25 @@ void OScriptLanguage::_init()
         const String format = settings->get_setting("settings/storage_format", "Text");
         if (format.match("Binary"))
             _extension = ORCHESTRATOR_SCRIPT_EXTENSION;
+
+        // With agile flushing, buffered input events are dispatched between physics steps, after the
+        // snapshot was captured, so input callbacks would observe stale state. Query Input directly.
+        const bool agile_flushing = ProjectSettings::get_singleton()->get_setting("input_devices/buffering/agile_event_flushing", false);
+        _input_snapshot.set_enabled(settings->get_setting("settings/runtime/cache_input_actions", true) && !agile_flushing);
+        _error_reporter.set_interval(settings->get_setting("settings/runtime/error_report_interval_ms", 1000));
+
+        // A seed of 0 uses a non-deterministic seed
+        const int64_t seed = settings->get_setting("settings/runtime/random_seed", 0);
+        if (seed != 0)
+            seed_random(seed);
+        else
+            seed_random((static_cast<uint64_t>(UtilityFunctions::randi()) << 32) | UtilityFunctions::randi());
+
+        // Recording starts after seeding, so each track captures its instance's seeded stream.
+        // Only game sessions are recorded, the editor runs tool scripts only.
+        _execution_recording_path = settings->get_setting("settings/runtime/execution_recording_path", "");
+        if (!_execution_recording_path.is_empty() && !Engine::get_singleton()->is_editor_hint())
+            _execution_recorder.start(_execution_recording_path);
     }
 
     #if GODOT_VERSION >= 0x040300
@@ -77,6 +138,9 @@ void OScriptLanguage::_init()
         int max_call_stack = os->get_setting("settings/runtime/max_call_stack", 1024);
         _debug_max_call_stack = max_call_stack;
         _call_stack = memnew_arr(CallStack, _debug_max_call_stack + 1);
+
+        // Toggled by the editor's debugger plugin
+        EngineDebugger::get_singleton()->register_profiler(OScriptNodeProfiler::PROFILER_NAME, _node_profiler);
     }
     else
     {
@@ -335,10 +399,26 @@ void OScriptLanguage::_profiling_stop()
 
 void OScriptLanguage::_frame()
 {
+    // Called after the frame's physics and idle processing; input events dispatched before the next
+    // frame starts must observe the live Input state, so the snapshot is invalidated until refreshed.
+    _input_snapshot.invalidate();
+    _connect_input_snapshot();
+
+    _error_reporter.flush();
+    _execution_recorder.flush();
 }
 
 void OScriptLanguage::_finish()
 {
+    _error_reporter.flush(true);
+
+    #if GODOT_VERSION >= 0x040300
+    EngineDebugger* debugger = EngineDebugger::get_singleton();
+    if (debugger && debugger->has_profiler(OScriptNodeProfiler::PROFILER_NAME))
+        debugger->unregister_profiler(OScriptNodeProfiler::PROFILER_NAME);
+    #endif
+
+    _execution_recorder.stop();
 }
 
 #if GODOT_VERSION >= 0x040300
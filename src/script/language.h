@@ -20,6 +20,11 @@
 #include "common/logger.h"
 #include "common/version.h"
 #include "script/serialization/format_defs.h"
+#include "script/vm/error_reporter.h"
+#include "script/vm/execution_recorder.h"
+#include "script/vm/input_snapshot.h"
+#include "script/vm/node_profiler.h"
+#include "script/vm/random_stream.h"
 
 #include <godot_cpp/classes/mutex.hpp>
 #include <godot_cpp/classes/script.hpp>
@@ -46,6 +51,15 @@ class OScriptLanguage : public ScriptLanguageExtension
 protected:
     static void _bind_methods() { }
 
+    /// Connects the input snapshot to the scene tree's frame signals, if not yet connected.
+    void _connect_input_snapshot();
+
+    /// Dispatched at the start of each physics frame
+    void _on_physics_frame();
+
+    /// Dispatched at the start of each idle/process frame
+    void _on_process_frame();
+
 private:
 
     #if GODOT_VERSION >= 0x040300
@@ -64,6 +78,13 @@ private:
     HashMap<StringName, Variant> _global_constants;            //! Stores global constants
     HashMap<StringName, Variant> _named_global_constants;      //! Stores named global constants
     String _extension{ ORCHESTRATOR_SCRIPT_TEXT_EXTENSION };   //! The language's extension
+    OScriptInputSnapshot _input_snapshot;                      //! Shared input action state snapshot
+    bool _input_snapshot_connected{ false };                   //! Whether snapshot frame callbacks are connected
+    OScriptRandomStream _random;                               //! Root random stream, split per script instance
+    OScriptErrorReporter _error_reporter;                      //! Aggregates repeated runtime errors
+    OScriptExecutionRecorder _execution_recorder;              //! Records external inputs for replay
+    String _execution_recording_path;                          //! Where the recording is written
+    Ref<OScriptNodeProfiler> _node_profiler;                   //! Samples node executions for the editor heatmap
 
     #if GODOT_VERSION >= 0x040300
     int _debug_parse_err_line{ -1 };    //! The line number of the parse error
@@ -172,6 +193,30 @@ public:
 
     String get_script_extension_filter() const;
 
+    /// Get the shared input action snapshot
+    /// @return the input snapshot, never <code>null</code>
+    OScriptInputSnapshot* get_input_snapshot() { return &_input_snapshot; }
+
+    /// Get the shared runtime error reporter
+    /// @return the error reporter, never <code>null</code>
+    OScriptErrorReporter* get_error_reporter() { return &_error_reporter; }
+
+    /// Get the execution recorder
+    /// @return the execution recorder, never <code>null</code>
+    OScriptExecutionRecorder* get_execution_recorder() { return &_execution_recorder; }
+
+    /// Get the node profiler
+    /// @return the node profiler, never <code>null</code>
+    OScriptNodeProfiler* get_node_profiler() { return _node_profiler.ptr(); }
+
+    /// Seeds the root random stream, subsequently created script instances draw reproducible values.
+    /// @param p_seed the seed
+    void seed_random(uint64_t p_seed);
+
+    /// Creates a new random stream, split from the language's root stream.
+    /// @return an independent random stream
+    OScriptRandomStream create_random_stream();
+
     #ifdef TOOLS_ENABLED
     /// Get a list of all orchestration scripts
     /// @return list of references
@@ -179,6 +179,10 @@ void OScriptNode::reconstruct_node()
 
     post_reconstruct_node();
 
+    // References may have changed, i.e. a variable node now targets a different variable
+    if (_orchestration)
+        _orchestration->update_node_references(this);
+
     emit_changed();
 
     // Clear reconstruction flag
@@ -320,6 +320,12 @@ public:
     /// @return node's runtime instance
     virtual OScriptNodeInstance* instantiate();
 
+    /// Instantiate a runtime instance specialised for the statically inferred input types.
+    /// Specialised instances must produce the same results as the generic instance.
+    /// @param p_input_types the inferred type for each data input, <code>NIL</code> when not known
+    /// @return node's runtime instance, defaults to the generic instance
+    virtual OScriptNodeInstance* instantiate_specialized(const Vector<Variant::Type>& p_input_types) { return instantiate(); }
+
     /// Initializes the node from spawner data
     /// @param p_context the initialization context
     virtual void initialize(const OScriptNodeInitContext& p_context);
@@ -53,24 +53,26 @@ Ref<OScriptNodePin> OScriptNodePin::create(OScriptNode* p_owning_node, const Pro
 {
     Ref<OScriptNodePin> pin(memnew(OScriptNodePin));
     pin->_owning_node = p_owning_node;
-    pin->_property = p_property;
+
+    PropertyInfo property = p_property;
+    String target_class;
 
     #if GODOT_VERSION < 0x040300
-    if (pin->_property.usage == 7)
-        pin->_property.usage = PROPERTY_USAGE_DEFAULT;
+    if (property.usage == 7)
+        property.usage = PROPERTY_USAGE_DEFAULT;
     #endif
 
     if (PropertyUtils::is_enum(p_property))
     {
         pin->_flags.set_flag(ENUM);
         if (p_property.usage & PROPERTY_USAGE_CLASS_IS_ENUM)
-            pin->_target_class = p_property.class_name;
+            target_class = p_property.class_name;
     }
     else if (PropertyUtils::is_bitfield(p_property))
     {
         pin->_flags.set_flag(BITFIELD);
         if (p_property.usage & PROPERTY_USAGE_CLASS_IS_BITFIELD)
-            pin->_target_class = p_property.class_name;
+            target_class = p_property.class_name;
     }
 
     if (p_property.hint == PROPERTY_HINT_FILE)
@@ -78,17 +80,28 @@ Ref<OScriptNodePin> OScriptNodePin::create(OScriptNode* p_owning_node, const Pro
     else if (p_property.hint == PROPERTY_HINT_MULTILINE_TEXT)
         pin->_flags.set_flag(MULTILINE);
 
-    if (pin->_target_class.is_empty() && !p_property.class_name.is_empty())
+    if (target_class.is_empty() && !p_property.class_name.is_empty())
         if (p_property.hint == PROPERTY_HINT_RESOURCE_TYPE || p_property.type == Variant::OBJECT)
-            pin->_target_class = p_property.class_name;
+            target_class = p_property.class_name;
 
     // This will trigger an error during the validation/build, asking user to create the node
-    if (pin->_target_class != p_property.class_name)
+    if (target_class != p_property.class_name)
         pin->_valid = false;
 
+    pin->_update_descriptor(property, target_class, Variant());
+
     return pin;
 }
 
+void OScriptNodePin::_update_descriptor(const PropertyInfo& p_property, const String& p_target_class,
+                                        const Variant& p_generated_default_value)
+{
+    // Acquire before releasing, the arguments may refer to the current descriptor
+    const OScriptNodePinDescriptor* descriptor = OScriptNodePinDescriptor::acquire(p_property, p_target_class, p_generated_default_value);
+    OScriptNodePinDescriptor::release(_descriptor);
+    _descriptor = descriptor;
+}
+
 void OScriptNodePin::_clear_flag(Flags p_flag)
 {
     if (_flags.has_flag(p_flag))
@@ -104,10 +117,14 @@ bool OScriptNodePin::_load(const Dictionary& p_data)
     if (!p_data.has("pin_name"))
         return false;
 
-    _property.name = p_data["pin_name"];
+    PropertyInfo property = _descriptor->property;
+    String target_class = _descriptor->target_class;
+    Variant generated_default_value;
+
+    property.name = p_data["pin_name"];
 
     if (p_data.has("type"))
-        _property.type = VariantUtils::to_type(p_data["type"]);
+        property.type = VariantUtils::to_type(p_data["type"]);
 
     if (p_data.has("dir"))
         _direction = EPinDirection(int(p_data["dir"]));
@@ -120,42 +137,59 @@ bool OScriptNodePin::_load(const Dictionary& p_data)
 
     if (p_data.has("target_class"))
     {
-        _target_class = p_data["target_class"];
-        _property.class_name = _target_class;
+        target_class = p_data["target_class"];
+        property.class_name = target_class;
     }
 
     if (p_data.has("dv"))
         _default_value = p_data["dv"];
 
     if (p_data.has("gdv"))
-        _generated_default_value = p_data["gdv"];
+        generated_default_value = p_data["gdv"];
     else
-        _generated_default_value = VariantUtils::make_default(_property.type);
+        generated_default_value = VariantUtils::make_default(property.type);
 
     if (p_data.has("hint"))
-        _property.hint = p_data["hint"];
+        property.hint = p_data["hint"];
 
     if (p_data.has("hint_string"))
-        _property.hint_string = p_data["hint_string"];
+        property.hint_string = p_data["hint_string"];
 
     if (p_data.has("usage"))
-        _property.usage = p_data["usage"];
+        property.usage = p_data["usage"];
 
     #if GODOT_VERSION < 0x040300
-    if (_property.usage == 7)
-        _property.usage = PROPERTY_USAGE_DEFAULT;
+    if (property.usage == 7)
+        property.usage = PROPERTY_USAGE_DEFAULT;
     #endif
 
+    _update_descriptor(property, target_class, generated_default_value);
+
     return true;
 }
 
 Dictionary OScriptNodePin::_save()
 {
+    // This fixes any potential data issues and guarantees that a generated default value exists.
+    if (_descriptor->generated_default_value.get_type() == Variant::NIL)
+        _update_descriptor(_descriptor->property, _descriptor->target_class, VariantUtils::make_default(_descriptor->property.type));
+
+    #if GODOT_VERSION < 0x040300
+    if (_descriptor->property.usage == 7)
+    {
+        PropertyInfo property = _descriptor->property;
+        property.usage = PROPERTY_USAGE_DEFAULT;
+        _update_descriptor(property, _descriptor->target_class, _descriptor->generated_default_value);
+    }
+    #endif
+
+    const PropertyInfo& property = _descriptor->property;
+
     Dictionary data;
-    data["pin_name"] = _property.name;
+    data["pin_name"] = property.name;
 
-    if (_property.type != Variant::NIL)
-        data["type"] = _property.type;
+    if (property.type != Variant::NIL)
+        data["type"] = property.type;
 
     if (_direction != PD_Input)
         data["dir"] = _direction;
@@ -166,8 +200,8 @@ Dictionary OScriptNodePin::_save()
     if (!_label.is_empty())
         data["label"] = _label;
 
-    if (!_target_class.is_empty())
-        data["target_class"] = _target_class;
+    if (!_descriptor->target_class.is_empty())
+        data["target_class"] = _descriptor->target_class;
 
     if (_default_value.get_type() != Variant::NIL)
     {
@@ -175,26 +209,17 @@ Dictionary OScriptNodePin::_save()
             data["dv"] = _default_value;
     }
 
-    // This fixes any potential data issues and guarantees that a generated default value exists.
-    if (_generated_default_value.get_type() == Variant::NIL)
-        _generated_default_value = VariantUtils::make_default(_property.type);
-
-    if (VariantUtils::make_default(_property.type) != _generated_default_value)
-        data["gdv"] = _generated_default_value;
+    if (VariantUtils::make_default(property.type) != _descriptor->generated_default_value)
+        data["gdv"] = _descriptor->get_generated_default_value();
 
-    if (_property.hint != PROPERTY_HINT_NONE)
-        data["hint"] = _property.hint;
+    if (property.hint != PROPERTY_HINT_NONE)
+        data["hint"] = property.hint;
 
-    if (!_property.hint_string.is_empty())
-        data["hint_string"] = _property.hint_string;
-
-    #if GODOT_VERSION < 0x040300
-    if (_property.usage == 7)
-        _property.usage = PROPERTY_USAGE_DEFAULT;
-    #endif
+    if (!property.hint_string.is_empty())
+        data["hint_string"] = property.hint_string;
 
-    if (_property.usage != PROPERTY_USAGE_DEFAULT)
-        data["usage"] = _property.usage;
+    if (property.usage != PROPERTY_USAGE_DEFAULT)
+        data["usage"] = property.usage;
 
     return data;
 }
@@ -231,12 +256,24 @@ Ref<OScriptNodePin> OScriptNodePin::create(OScriptNode* p_owning_node)
 {
     Ref<OScriptNodePin> pin(memnew(OScriptNodePin));
     pin->_owning_node = p_owning_node;
-    pin->_property.type = Variant::NIL;
-    pin->_property.hint = PROPERTY_HINT_NONE;
-    pin->_property.usage = PROPERTY_USAGE_DEFAULT;
     return pin;
 }
 
+OScriptNodePin::OScriptNodePin()
+{
+    PropertyInfo property;
+    property.type = Variant::NIL;
+    property.hint = PROPERTY_HINT_NONE;
+    property.usage = PROPERTY_USAGE_DEFAULT;
+
+    _descriptor = OScriptNodePinDescriptor::acquire(property, String(), Variant());
+}
+
+OScriptNodePin::~OScriptNodePin()
+{
+    OScriptNodePinDescriptor::release(_descriptor);
+}
+
 void OScriptNodePin::post_initialize()
 {
     _set_type_resets_default = true;
@@ -270,64 +307,71 @@ int32_t OScriptNodePin::get_pin_index() const
 
 StringName OScriptNodePin::get_pin_name() const
 {
-    return _property.name;
+    return _descriptor->property.name;
 }
 
 void OScriptNodePin::set_pin_name(const StringName& p_pin_name)
 {
-    if (!_property.name.match(p_pin_name))
+    if (!_descriptor->property.name.match(p_pin_name))
     {
-        _property.name = p_pin_name;
+        PropertyInfo property = _descriptor->property;
+        property.name = p_pin_name;
+        _update_descriptor(property, _descriptor->target_class, _descriptor->generated_default_value);
         emit_changed();
     }
 }
 
 Variant::Type OScriptNodePin::get_type() const
 {
-    return _property.type;
+    return _descriptor->property.type;
 }
 
 void OScriptNodePin::set_type(Variant::Type p_type)
 {
-    if (_property.type != p_type)
+    if (_descriptor->property.type != p_type)
     {
-        _property.type = p_type;
+        PropertyInfo property = _descriptor->property;
+        property.type = p_type;
 
+        Variant generated_default_value = _descriptor->generated_default_value;
         if (_set_type_resets_default)
         {
             _default_value = Variant();
-            _generated_default_value = _target_class.is_empty() ? VariantUtils::make_default(_property.type) : Variant();
+            generated_default_value = _descriptor->target_class.is_empty() ? VariantUtils::make_default(p_type) : Variant();
         }
 
+        _update_descriptor(property, _descriptor->target_class, generated_default_value);
         emit_changed();
     }
 }
 
 String OScriptNodePin::get_pin_type_name() const
 {
-    return PropertyUtils::get_property_type_name(_property);
+    return PropertyUtils::get_property_type_name(_descriptor->property);
 }
 
 StringName OScriptNodePin::get_target_class() const
 {
-    return _target_class;
+    return _descriptor->target_class;
 }
 
 void OScriptNodePin::set_target_class(const StringName& p_target_class)
 {
-    if (_target_class != p_target_class)
+    const String target_class = p_target_class;
+    if (_descriptor->target_class != target_class)
     {
-        _target_class = p_target_class;
-
-        if (!_target_class.is_empty())
-            _property.type = Variant::OBJECT;
+        PropertyInfo property = _descriptor->property;
+        if (!target_class.is_empty())
+            property.type = Variant::OBJECT;
 
+        Variant generated_default_value = _descriptor->generated_default_value;
         if (_set_type_resets_default)
         {
             _default_value = Variant();
-            _generated_default_value = _target_class.is_empty() ? VariantUtils::make_default(_property.type) : Variant();
+            generated_default_value = target_class.is_empty() ? VariantUtils::make_default(property.type) : Variant();
         }
 
+        _update_descriptor(property, target_class, generated_default_value);
         emit_changed();
     }
 }
@@ -357,19 +401,19 @@ void OScriptNodePin::set_default_value(const Variant& p_default_value)
 
 void OScriptNodePin::reset_default_value()
 {
-    set_default_value(_generated_default_value);
+    set_default_value(_descriptor->get_generated_default_value());
 }
 
 Variant OScriptNodePin::get_generated_default_value() const
 {
-    return _generated_default_value;
+    return _descriptor->get_generated_default_value();
 }
 
 void OScriptNodePin::set_generated_default_value(const Variant& p_default_value)
 {
-    if (_generated_default_value != p_default_value)
+    if (_descriptor->generated_default_value != p_default_value)
     {
-        _generated_default_value = p_default_value;
+        _update_descriptor(_descriptor->property, _descriptor->target_class, p_default_value);
         emit_changed();
     }
 }
@@ -454,14 +498,18 @@ void OScriptNodePin::no_pretty_format()
 
 void OScriptNodePin::set_file_types(const String& p_file_types)
 {
-    if (_property.hint == PROPERTY_HINT_FILE || _flags.has_flag(FILE))
-        _property.hint_string = p_file_types;
+    if (_descriptor->property.hint == PROPERTY_HINT_FILE || _flags.has_flag(FILE))
+    {
+        PropertyInfo property = _descriptor->property;
+        property.hint_string = p_file_types;
+        _update_descriptor(property, _descriptor->target_class, _descriptor->generated_default_value);
+    }
 }
 
 String OScriptNodePin::get_file_types() const
 {
-    if (_property.hint == PROPERTY_HINT_FILE || _flags.has_flag(FILE))
-        return _property.hint_string;
+    if (_descriptor->property.hint == PROPERTY_HINT_FILE || _flags.has_flag(FILE))
+        return _descriptor->property.hint_string;
     return "";
 }
 
@@ -480,13 +528,13 @@ bool OScriptNodePin::can_accept(const Ref<OScriptNodePin>& p_pin) const
         return false;
 
     // Any pin can connect to a Boolean input pin.
-    if (_property.type == Variant::BOOL)
+    if (_descriptor->property.type == Variant::BOOL)
         return true;
 
     // Types match
-    if (_property.type == p_pin->get_type())
+    if (_descriptor->property.type == p_pin->get_type())
     {
-        const String target_class = _property.class_name;
+        const String target_class = _descriptor->property.class_name;
         const String source_class = p_pin->get_property_info().class_name;
         if (!target_class.is_empty() && !source_class.is_empty())
         {
@@ -504,7 +552,7 @@ bool OScriptNodePin::can_accept(const Ref<OScriptNodePin>& p_pin) const
         else if (target_class.is_empty() && !source_class.is_empty())
         {
             // If the source is a derived object type of the target, thats fine
-            if (_property.type == Variant::OBJECT)
+            if (_descriptor->property.type == Variant::OBJECT)
                 return true;
 
             // If source is an enum/bitfield, allow coercion
@@ -516,10 +564,10 @@ bool OScriptNodePin::can_accept(const Ref<OScriptNodePin>& p_pin) const
     }
 
     // Coercion is allowed here
-    if (_property.type == Variant::STRING)
+    if (_descriptor->property.type == Variant::STRING)
     {
         // File targets should only accept string sources
-        if (_property.hint == PROPERTY_HINT_FILE)
+        if (_descriptor->property.hint == PROPERTY_HINT_FILE)
         {
             if (!(p_pin->get_type() == Variant::STRING || PropertyUtils::is_variant(p_pin->get_property_info())))
                 return false;
@@ -527,16 +575,16 @@ bool OScriptNodePin::can_accept(const Ref<OScriptNodePin>& p_pin) const
         return true;
     }
 
-    if (_property.type == Variant::STRING_NAME && p_pin->get_property_info().type == Variant::STRING)
+    if (_descriptor->property.type == Variant::STRING_NAME && p_pin->get_property_info().type == Variant::STRING)
         return true;
 
     // Numeric conversions allows
-    if (_property.type == Variant::INT || _property.type == Variant::FLOAT)
+    if (_descriptor->property.type == Variant::INT || _descriptor->property.type == Variant::FLOAT)
         if (p_pin->get_type() == Variant::INT || p_pin->get_type() == Variant::FLOAT)
             return true;
 
     // Allow any-to-specific or specific-to-any
-    if (PropertyUtils::is_variant(_property) || PropertyUtils::is_variant(p_pin->get_property_info()))
+    if (PropertyUtils::is_variant(_descriptor->property) || PropertyUtils::is_variant(p_pin->get_property_info()))
         return true;
 
     return false;
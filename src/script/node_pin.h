@@ -18,6 +18,7 @@
 #define ORCHESTRATOR_SCRIPT_NODE_PIN_H
 
 #include "common/guid.h"
+#include "script/node_pin_descriptor.h"
 #include "script/target_object.h"
 
 #include <godot_cpp/classes/resource.hpp>
@@ -98,10 +99,8 @@ public:
     };
 
 private:
-    PropertyInfo _property;                    //! Pin's property details
-    String _target_class;                      //! The target class associated with the pin
+    const OScriptNodePinDescriptor* _descriptor{ nullptr };  //! Shared property, target class, and generated default
     Variant _default_value;                    //! The default value
-    Variant _generated_default_value;          //! Generated default value
     EPinDirection _direction{ PD_Input };      //! The direction
     BitField<Flags> _flags{ 0 };               //! Pin flags
     String _label;                             //! A custom label name
@@ -119,6 +118,13 @@ protected:
     /// @return the script pin refererence
     static Ref<OScriptNodePin> create(OScriptNode* p_owning_node, const PropertyInfo& p_property);
 
+    /// Replaces the pin's shared descriptor with one describing the supplied details
+    /// @param p_property the property info
+    /// @param p_target_class the target class
+    /// @param p_generated_default_value the generated default value
+    void _update_descriptor(const PropertyInfo& p_property, const String& p_target_class,
+                            const Variant& p_generated_default_value);
+
     /// Clears a specific flag on the pin
     /// @param p_flag the flag to clear
     void _clear_flag(Flags p_flag);
@@ -135,6 +141,8 @@ protected:
     Vector2 _calculate_midpoint_between_nodes(const Ref<OScriptNode>& p_source, const Ref<OScriptNode>& p_target) const;
 
 public:
+    OScriptNodePin();
+    ~OScriptNodePin() override;
 
     /// Perform pin post initialization
     virtual void post_initialize();
@@ -162,7 +170,7 @@ public:
 
     /// Get the pin's property info
     /// @return an immutable property info that describes the pin
-    const PropertyInfo& get_property_info() const { return _property; }
+    const PropertyInfo& get_property_info() const { return _descriptor->property; }
 
     /// Get the pin's name
     /// @return the pin's name
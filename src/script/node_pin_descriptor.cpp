@@ -0,0 +1,150 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/node_pin_descriptor.h"
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include <mutex>
+
+namespace
+{
+    // Pins are created by threaded resource loads, so the pool is guarded. A standard mutex is used
+    // rather than a Godot Mutex, as descriptors can outlive the engine objects during shutdown.
+    std::mutex pool_lock;
+
+    // Descriptors bucketed by their content hash
+    using DescriptorPool = HashMap<uint32_t, LocalVector<OScriptNodePinDescriptor*>>;
+
+    // Allocated with the first descriptor and freed with the last, so no memory is held at exit.
+    DescriptorPool* pool = nullptr;
+    uint32_t pool_size = 0;
+
+    uint32_t hash_descriptor(const PropertyInfo& p_property, const String& p_target_class,
+                             const Variant& p_generated_default_value)
+    {
+        uint32_t hash = hash_murmur3_one_32(p_property.type);
+        hash = hash_murmur3_one_32(static_cast<uint32_t>(p_property.name.hash()), hash);
+        hash = hash_murmur3_one_32(static_cast<uint32_t>(p_property.class_name.hash()), hash);
+        hash = hash_murmur3_one_32(p_property.hint, hash);
+        hash = hash_murmur3_one_32(static_cast<uint32_t>(p_property.hint_string.hash()), hash);
+        hash = hash_murmur3_one_32(p_property.usage, hash);
+        hash = hash_murmur3_one_32(static_cast<uint32_t>(p_target_class.hash()), hash);
+        hash = hash_murmur3_one_32(p_generated_default_value.get_type(), hash);
+        hash = hash_murmur3_one_32(static_cast<uint32_t>(p_generated_default_value.hash()), hash);
+        return hash_fmix32(hash);
+    }
+
+    bool is_same_descriptor(const OScriptNodePinDescriptor* p_descriptor, const PropertyInfo& p_property,
+                            const String& p_target_class, const Variant& p_generated_default_value)
+    {
+        const PropertyInfo& property = p_descriptor->property;
+        return property.type == p_property.type
+            && property.name == p_property.name
+            && property.class_name == p_property.class_name
+            && property.hint == p_property.hint
+            && property.hint_string == p_property.hint_string
+            && property.usage == p_property.usage
+            && p_descriptor->target_class == p_target_class
+            && p_descriptor->generated_default_value.get_type() == p_generated_default_value.get_type()
+            && p_descriptor->generated_default_value.hash_compare(p_generated_default_value);
+    }
+}
+
+const OScriptNodePinDescriptor* OScriptNodePinDescriptor::acquire(const PropertyInfo& p_property,
+                                                                  const String& p_target_class,
+                                                                  const Variant& p_generated_default_value)
+{
+    const uint32_t hash = hash_descriptor(p_property, p_target_class, p_generated_default_value);
+
+    std::lock_guard<std::mutex> lock(pool_lock);
+
+    if (!pool)
+        pool = memnew(DescriptorPool);
+
+    LocalVector<OScriptNodePinDescriptor*>& bucket = (*pool)[hash];
+    for (OScriptNodePinDescriptor* descriptor : bucket)
+    {
+        if (is_same_descriptor(descriptor, p_property, p_target_class, p_generated_default_value))
+        {
+            descriptor->refcount++;
+            return descriptor;
+        }
+    }
+
+    OScriptNodePinDescriptor* descriptor = memnew(OScriptNodePinDescriptor);
+    descriptor->property = p_property;
+    descriptor->target_class = p_target_class;
+    descriptor->generated_default_value = p_generated_default_value.duplicate(true);
+    descriptor->hash = hash;
+    descriptor->refcount = 1;
+
+    bucket.push_back(descriptor);
+    pool_size++;
+
+    return descriptor;
+}
+
+Variant OScriptNodePinDescriptor::get_generated_default_value() const
+{
+    switch (generated_default_value.get_type())
+    {
+        case Variant::ARRAY:
+        case Variant::DICTIONARY:
+            return generated_default_value.duplicate(true);
+        default:
+            return generated_default_value;
+    }
+}
+
+void OScriptNodePinDescriptor::release(const OScriptNodePinDescriptor* p_descriptor)
+{
+    if (!p_descriptor)
+        return;
+
+    std::lock_guard<std::mutex> lock(pool_lock);
+
+    OScriptNodePinDescriptor* descriptor = const_cast<OScriptNodePinDescriptor*>(p_descriptor);
+    if (--descriptor->refcount > 0)
+        return;
+
+    ERR_FAIL_NULL(pool);
+
+    const DescriptorPool::Iterator E = pool->find(descriptor->hash);
+    if (E)
+    {
+        E->value.erase(descriptor);
+        if (E->value.is_empty())
+            pool->remove(E);
+    }
+
+    memdelete(descriptor);
+    pool_size--;
+
+    if (pool->is_empty())
+    {
+        memdelete(pool);
+        pool = nullptr;
+    }
+}
+
+uint32_t OScriptNodePinDescriptor::get_pool_size()
+{
+    std::lock_guard<std::mutex> lock(pool_lock);
+    return pool_size;
+}
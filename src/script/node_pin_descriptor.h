@@ -0,0 +1,62 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_NODE_PIN_DESCRIPTOR_H
+#define ORCHESTRATOR_SCRIPT_NODE_PIN_DESCRIPTOR_H
+
+#include <godot_cpp/core/property_info.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+using namespace godot;
+
+/// Describes the type of a node pin.
+///
+/// Pins created from the same method or property signature describe identical types, so rather
+/// than each pin holding its own copy, descriptors are interned into a shared pool keyed by their
+/// contents. Descriptors are immutable, a pin that changes its type acquires another descriptor.
+///
+struct OScriptNodePinDescriptor
+{
+    PropertyInfo property;              //! Pin's property details
+    String target_class;                //! The target class associated with the pin
+    Variant generated_default_value;    //! Generated default value
+    uint32_t hash{ 0 };                 //! Hash of the descriptor contents
+    uint32_t refcount{ 0 };             //! Number of pins using the descriptor, guarded by the pool lock
+
+    /// Acquires a shared descriptor, creating one if no descriptor with the same contents exists.
+    /// Each acquired descriptor must be released with <code>release</code>.
+    /// @param p_property the property info
+    /// @param p_target_class the target class
+    /// @param p_generated_default_value the generated default value
+    /// @return the shared descriptor, never null
+    static const OScriptNodePinDescriptor* acquire(const PropertyInfo& p_property, const String& p_target_class,
+                                                   const Variant& p_generated_default_value);
+
+    /// Get a copy of the generated default value. Containers are copied, as the descriptor's value is
+    /// shared by every pin that uses it and placed the descriptor in the pool by its hash.
+    /// @return the generated default value
+    Variant get_generated_default_value() const;
+
+    /// Releases a descriptor, freeing it once it is no longer used by any pin
+    /// @param p_descriptor the descriptor, may be null
+    static void release(const OScriptNodePinDescriptor* p_descriptor);
+
+    /// Get the number of distinct descriptors currently shared in the pool
+    /// @return the number of pooled descriptors
+    static uint32_t get_pool_size();
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_NODE_PIN_DESCRIPTOR_H
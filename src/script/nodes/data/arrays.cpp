@@ -27,9 +27,11 @@ class OScriptNodeMakeArrayInstance : public OScriptNodeInstance
 public:
     int step(OScriptExecutionContext& p_context) override
     {
+        // The array is the node's output and outlives the step, size it once rather than per element
         Array result;
+        result.resize(_count);
         for (int i = 0; i < _count; i++)
-            result.push_back(p_context.get_input(i));
+            result[i] = p_context.get_input(i);
 
         p_context.set_output(0, result);
         return 0;
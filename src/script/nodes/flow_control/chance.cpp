@@ -21,16 +21,12 @@
 class OScriptNodeChanceInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeChance);
-    Ref<RandomNumberGenerator> _random;
     int _chance{ 0 };
 
 public:
     int step(OScriptExecutionContext& p_context) override
     {
-        if (!_random.is_valid())
-            _random.instantiate();
-
-        const int _calculated_chance = _random->randi_range(0, 100);
+        const int _calculated_chance = p_context.get_runtime()->get_random().range(0, 100);
         return _calculated_chance <= _chance ? 0 : 1;
     }
 };
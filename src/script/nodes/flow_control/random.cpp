@@ -22,7 +22,6 @@ class OScriptNodeRandomInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeRandom);
 
-    Ref<RandomNumberGenerator> _random;
     int _possibilities{ 0 };
 
 public:
@@ -31,10 +30,7 @@ public:
         if (_possibilities == 0)
             return -1;
 
-        if (!_random.is_valid())
-            _random.instantiate();
-
-        return _random->randi_range(0, _possibilities - 1);
+        return p_context.get_runtime()->get_random().range(0, _possibilities - 1);
     }
 };
 
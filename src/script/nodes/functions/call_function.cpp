@@ -21,14 +21,26 @@
 #include "common/property_utils.h"
 #include "common/string_utils.h"
 #include "common/variant_utils.h"
+#include "script/vm/script_vm.h"
 
 #include <godot_cpp/classes/expression.hpp>
 #include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/core/math.hpp>
 
 class OScriptNodeCallFunctionInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeCallFunction);
 
+    enum RandomFunction
+    {
+        RF_NONE,
+        RF_RANDF,
+        RF_RANDI,
+        RF_RANDF_RANGE,
+        RF_RANDI_RANGE,
+        RF_RANDFN
+    };
+
     OScriptFunctionReference _reference;
     int _argument_count{ 0 };
     int _argument_offset{ 2 };
@@ -36,47 +48,104 @@ class OScriptNodeCallFunctionInstance : public OScriptNodeInstance
     bool _self{ false };
     bool _target{ false };
     bool _chained{ false };
-    Array _args;
+    bool _script_function{ false };
+    Ref<Expression> _pure_expression;  //! Parsed pure call expression, reused between calls
+    RandomFunction _random{ RF_NONE }; //! Random utility function drawn from the instance's stream
 
-    int _do_pure(OScriptExecutionContext& p_context) const
+    int _do_random(OScriptExecutionContext& p_context)
     {
-        // Pure function calls use the Godot Expression class to evaluate the function call.
-        // This requires that we bind the arguments using a variant Array.
-        // Additionally, we need to generate argument name bindings for the expression.
-        Array args;
-        PackedStringArray arg_names;
-        for (int i = 0; i < _argument_count; i++)
+        // Random utility functions draw from the instance's seedable stream rather than the engine's
+        // global generator, so that they're reproducible with the runtime random seed.
+        OScriptRandomStream& random = p_context.get_runtime()->get_random();
+
+        Variant result;
+        switch (_random)
         {
-            args.push_back(p_context.get_input(i + _argument_offset));
-            arg_names.push_back(vformat("x%d", i));
+            case RF_RANDF:
+                result = random.randd();
+                break;
+            case RF_RANDI:
+                result = static_cast<int64_t>(random.next());
+                break;
+            case RF_RANDF_RANGE:
+            {
+                const double from = p_context.get_input(_argument_offset);
+                const double to = p_context.get_input(_argument_offset + 1);
+                result = from + random.randd() * (to - from);
+                break;
+            }
+            case RF_RANDI_RANGE:
+            {
+                const int from = p_context.get_input(_argument_offset);
+                const int to = p_context.get_input(_argument_offset + 1);
+                result = random.range(MIN(from, to), MAX(from, to));
+                break;
+            }
+            case RF_RANDFN:
+            {
+                // Box-Muller transform, the first sample is kept away from zero for the logarithm
+                const double mean = p_context.get_input(_argument_offset);
+                const double deviation = p_context.get_input(_argument_offset + 1);
+                const double u1 = 1.0 - random.randd();
+                const double u2 = random.randd();
+                result = mean + deviation * Math::sqrt(-2.0 * Math::log(u1)) * Math::cos(Math_TAU * u2);
+                break;
+            }
+            default:
+                break;
         }
 
-        // Create the expression to be parsed
-        const String expression = vformat("%s(%s)", _reference.method.name, StringUtils::join(",", arg_names));
-
-        Ref<Expression> parser;
-        parser.instantiate();
+        p_context.set_output(0, result);
+        return 0;
+    }
 
-        Error err = parser->parse(expression, arg_names);
-        if (err == Error::OK)
+    int _do_pure(OScriptExecutionContext& p_context)
+    {
+        // Pure function calls use the Godot Expression class to evaluate the function call.
+        // The expression only depends on the function and its argument count, so it is parsed
+        // on the first call and reused, rather than building the argument names each call.
+        if (!_pure_expression.is_valid())
         {
-            // Execute the expression with the provided arguments.
-            // This requires an instance object, we use the script owner.
-            Variant result = parser->execute(args, p_context.get_owner());
-            if (!parser->has_execute_failed())
-            {
-                // Execution was successful, set output if applicable.
-                if (MethodUtils::has_return_value(_reference.method))
-                    p_context.set_output(0, result);
+            PackedStringArray arg_names;
+            for (int i = 0; i < _argument_count; i++)
+                arg_names.push_back(vformat("x%d", i));
+
+            // Create the expression to be parsed
+            const String expression = vformat("%s(%s)", _reference.method.name, StringUtils::join(",", arg_names));
+
+            Ref<Expression> parser;
+            parser.instantiate();
 
-                return 0;
+            Error err = parser->parse(expression, arg_names);
+            if (err != Error::OK)
+            {
+                p_context.set_error(vformat("Error %d: Failed to parse expression: %s", err, expression));
+                return -1 | STEP_FLAG_END;
             }
 
-            p_context.set_error(vformat("Failed to evaluate expression: %s", parser->get_error_text()));
-            return -1 | STEP_FLAG_END;
+            _pure_expression = parser;
         }
 
-        p_context.set_error(vformat("Error %d: Failed to parse expression: %s", err, expression));
+        // This requires that we bind the arguments using a variant Array.
+        // The array is local, as the expression may call back into this node before it returns.
+        Array args;
+        args.resize(_argument_count);
+        for (int i = 0; i < _argument_count; i++)
+            args[i] = p_context.get_input(i + _argument_offset);
+
+        // Execute the expression with the provided arguments.
+        // This requires an instance object, we use the script owner.
+        Variant result = _pure_expression->execute(args, p_context.get_owner());
+        if (!_pure_expression->has_execute_failed())
+        {
+            // Execution was successful, set output if applicable.
+            if (MethodUtils::has_return_value(_reference.method))
+                p_context.set_output(0, result);
+
+            return 0;
+        }
+
+        p_context.set_error(vformat("Failed to evaluate expression: %s", _pure_expression->get_error_text()));
         return -1 | STEP_FLAG_END;
     }
 
@@ -100,6 +169,41 @@ class OScriptNodeCallFunctionInstance : public OScriptNodeInstance
         return 0;
     }
 
+    int _do_replay(OScriptExecutionContext& p_context, Object* p_instance) const
+    {
+        OScriptVirtualMachine* runtime = p_context.get_runtime();
+
+        Variant result;
+        if (_script_function)
+        {
+            // The replayed owner has no script attached, call the function directly
+            GDExtensionCallError err;
+            const Variant** pargs = _argument_count > 0 ? p_context.get_input_ptr() + _argument_offset : nullptr;
+            runtime->call_method(p_context.get_script_instance(), _reference.method.name, pargs, _argument_count, &result, &err);
+            if (err.error != GDEXTENSION_CALL_OK)
+            {
+                p_context.set_error(err);
+                return -1 | STEP_FLAG_END;
+            }
+        }
+        else
+        {
+            result = runtime->replay_result(p_context.get_script_instance());
+        }
+
+        int chain_index = 0;
+        if (MethodUtils::has_return_value(_reference.method))
+        {
+            p_context.set_output(0, result);
+            chain_index = 1;
+        }
+
+        if (_chained)
+            p_context.set_output(chain_index, p_instance);
+
+        return 0;
+    }
+
     Object* _get_call_instance(OScriptExecutionContext& p_context)
     {
         if (_argument_offset == 0)
@@ -112,17 +216,25 @@ class OScriptNodeCallFunctionInstance : public OScriptNodeInstance
     }
 
 public:
+    bool is_external_input() const override { return _pure; }
+
     int step(OScriptExecutionContext& p_context) override
     {
         // Check if function call is pure
         if (_pure)
-            return _do_pure(p_context);
+            return _random != RF_NONE ? _do_random(p_context) : _do_pure(p_context);
 
         // Check if the function call is on a specific target type
         if (_reference.target_type != Variant::NIL && _reference.target_type != Variant::OBJECT)
             return _do_target_type(p_context);
 
         Object* instance = _get_call_instance(p_context);
+
+        // Replays substitute the recorded results for calls outside of this script
+        OScriptVirtualMachine* runtime = p_context.get_runtime();
+        if (runtime->is_replaying())
+            return _do_replay(p_context, instance);
+
         if (!instance)
         {
             GDExtensionCallError error;
@@ -131,27 +243,40 @@ public:
             return -1 | STEP_FLAG_END;
         }
 
-        // Handle instanced function calls
-        if (_argument_count > 0)
+        // The call's result is returned by the function, reuse the caller's frame
+        if (tail_call && p_context.can_tail_call())
         {
-            if (_args.size() != _argument_count)
-                _args.resize(_argument_count);
+            p_context.request_tail_call(_reference.method.name, p_context.get_input_ptr() + _argument_offset, _argument_count);
+            return STEP_FLAG_TAIL_CALL;
+        }
 
-            for (int i = 0; i < _argument_count; i++)
-                _args[i] = p_context.get_input(i + _argument_offset);
+        // Handle instanced function calls, passing the input slots directly rather than copying
+        // them into an array, which a nested call through this node would otherwise overwrite.
+        const Variant** pargs = _argument_count > 0 ? p_context.get_input_ptr() + _argument_offset : nullptr;
+
+        runtime->set_script_call(_script_function);
+
+        GDExtensionCallError err;
+        Variant result;
+        Variant(instance).callp(_reference.method.name, pargs, _argument_count, result, err);
+
+        runtime->set_script_call(false);
+
+        if (!_script_function && runtime->is_recording())
+            runtime->record_result(result);
+
+        if (err.error != GDEXTENSION_CALL_OK)
+        {
+            p_context.set_error(err);
+            return -1 | STEP_FLAG_END;
         }
 
         int chain_index = 0;
         if (MethodUtils::has_return_value(_reference.method))
         {
-            Variant result = instance->callv(_reference.method.name, _args);
             p_context.set_output(0, result);
             chain_index = 1;
         }
-        else
-        {
-            instance->callv(_reference.method.name, _args);
-        }
 
         if (_chained)
             p_context.set_output(chain_index, instance);
@@ -457,6 +582,22 @@ OScriptNodeInstance* OScriptNodeCallFunction::instantiate()
     i->_reference = _reference;
     i->_pure = _function_flags.has_flag(FF_PURE);
 
+    // Pure calls are evaluated as global expressions, so these names always resolve to the utilities
+    if (i->_pure)
+    {
+        const StringName& name = _reference.method.name;
+        if (name == StringName("randf") && i->_argument_count == 0)
+            i->_random = OScriptNodeCallFunctionInstance::RF_RANDF;
+        else if (name == StringName("randi") && i->_argument_count == 0)
+            i->_random = OScriptNodeCallFunctionInstance::RF_RANDI;
+        else if (name == StringName("randf_range") && i->_argument_count == 2)
+            i->_random = OScriptNodeCallFunctionInstance::RF_RANDF_RANGE;
+        else if (name == StringName("randi_range") && i->_argument_count == 2)
+            i->_random = OScriptNodeCallFunctionInstance::RF_RANDI_RANGE;
+        else if (name == StringName("randfn") && i->_argument_count == 2)
+            i->_random = OScriptNodeCallFunctionInstance::RF_RANDFN;
+    }
+
     if (_function_flags.has_flag(FF_TARGET))
     {
         Ref<OScriptNodePin> target = find_pin("target", PD_Input);
@@ -467,6 +608,7 @@ OScriptNodeInstance* OScriptNodeCallFunction::instantiate()
     }
 
     i->_chained = _chain;
+    i->_script_function = _function_flags.has_flag(FF_IS_SELF);
     return i;
 }
 
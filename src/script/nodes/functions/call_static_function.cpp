@@ -46,20 +46,16 @@ public:
             return -1 | STEP_FLAG_END;
         }
 
-        Array args;
-        for (size_t i = 0; i < _method.arguments.size(); i++)
-            args.push_back(p_context.get_input(i));
-
-        std::vector<const Variant*> call_args;
-        call_args.resize(_method.arguments.size());
-
-        for (int i = 0; i < args.size(); i++)
-            call_args[i] = &args[i];
+        // Call directly with the input slots, avoids copying the arguments on each call
+        const uint32_t arg_count = _method.arguments.size();
+        const Variant** call_args = p_context.allocate_scratch<const Variant*>(arg_count);
+        for (uint32_t i = 0; i < arg_count; i++)
+            call_args[i] = &p_context.get_input(i);
 
         Variant ret;
         GDExtensionCallError r_error;
         internal::gdextension_interface_object_method_bind_call(
-            mb, nullptr, reinterpret_cast<GDExtensionConstVariantPtr*>(call_args.data()), call_args.size(), &ret, &r_error);
+            mb, nullptr, reinterpret_cast<GDExtensionConstVariantPtr*>(call_args), arg_count, &ret, &r_error);
 
         if (r_error.error != GDEXTENSION_CALL_OK)
         {
@@ -28,10 +28,14 @@ class OScriptNodeInputActionInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeInputAction);
 
-    String _action_name;
+    StringName _action_name;
+    int _action_index{ -1 };
+    OScriptInputSnapshot* _snapshot{ nullptr };
     OScriptNodeInputAction::ActionMode _mode;
 
 public:
+    bool is_external_input() const override { return true; }
+
     int step(OScriptExecutionContext& p_context) override
     {
         Input* input = Input::get_singleton();
@@ -47,26 +51,20 @@ public:
             return -1 | STEP_FLAG_END;
         }
 
-        if (_action_name.is_empty())
-        {
-            p_context.set_error("An action name must be specified.");
-            return -1 | STEP_FLAG_END;
-        }
-
         bool result = false;
         switch (_mode)
         {
             case OScriptNodeInputAction::AM_PRESSED:
-                result = input->is_action_pressed(_action_name);
+                result = _snapshot->is_action_pressed(_action_index, _action_name);
                 break;
             case OScriptNodeInputAction::AM_RELEASED:
-                result = !input->is_action_pressed(_action_name);
+                result = !_snapshot->is_action_pressed(_action_index, _action_name);
                 break;
             case OScriptNodeInputAction::AM_JUST_PRESSED:
-                result = input->is_action_just_pressed(_action_name);
+                result = _snapshot->is_action_just_pressed(_action_index, _action_name);
                 break;
             case OScriptNodeInputAction::AM_JUST_RELEASED:
-                result = input->is_action_just_released(_action_name);
+                result = _snapshot->is_action_just_released(_action_index, _action_name);
                 break;
         }
         p_context.set_output(0, result);
@@ -215,6 +213,8 @@ OScriptNodeInstance* OScriptNodeInputAction::instantiate()
     i->_node = this;
     i->_action_name = _action_name;
     i->_mode = ActionMode(_mode);
+    i->_snapshot = OScriptLanguage::get_singleton()->get_input_snapshot();
+    i->_action_index = i->_snapshot->register_action(i->_action_name);
     return i;
 }
 
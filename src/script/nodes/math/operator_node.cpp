@@ -26,6 +26,8 @@
 class OScriptNodeOperatorInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeOperator);
+
+protected:
     Variant::Operator _operator{ Variant::Operator::OP_EQUAL };
     bool _unary{ false };
     Variant _result;
@@ -57,6 +59,160 @@ public:
     }
 };
 
+/// An operator instance specialised for operands statically inferred as <code>bool</code>, <code>int</code>,
+/// or <code>float</code>. The operands are evaluated natively, bypassing the Variant operator dispatch.
+/// The operand types are verified on each step, and any operation or type combination that is not
+/// handled natively falls back to the generic evaluation, so results are identical in all cases.
+class OScriptNodeOperatorScalarInstance : public OScriptNodeOperatorInstance
+{
+    friend class OScriptNodeOperator;
+
+    Variant::Type _left_type{ Variant::NIL };
+    Variant::Type _right_type{ Variant::NIL };
+
+    static bool _evaluate_int(Variant::Operator p_operator, int64_t p_left, int64_t p_right, Variant& r_result)
+    {
+        // Arithmetic is performed unsigned to match the engine's wrapping behavior without undefined behavior
+        switch (p_operator)
+        {
+            case Variant::OP_ADD: r_result = int64_t(uint64_t(p_left) + uint64_t(p_right)); return true;
+            case Variant::OP_SUBTRACT: r_result = int64_t(uint64_t(p_left) - uint64_t(p_right)); return true;
+            case Variant::OP_MULTIPLY: r_result = int64_t(uint64_t(p_left) * uint64_t(p_right)); return true;
+            case Variant::OP_EQUAL: r_result = p_left == p_right; return true;
+            case Variant::OP_NOT_EQUAL: r_result = p_left != p_right; return true;
+            case Variant::OP_LESS: r_result = p_left < p_right; return true;
+            case Variant::OP_LESS_EQUAL: r_result = p_left <= p_right; return true;
+            case Variant::OP_GREATER: r_result = p_left > p_right; return true;
+            case Variant::OP_GREATER_EQUAL: r_result = p_left >= p_right; return true;
+            case Variant::OP_BIT_AND: r_result = p_left & p_right; return true;
+            case Variant::OP_BIT_OR: r_result = p_left | p_right; return true;
+            case Variant::OP_BIT_XOR: r_result = p_left ^ p_right; return true;
+            default: return false; // Division, modulo, and shifts validate their operands
+        }
+    }
+
+    static bool _evaluate_float(Variant::Operator p_operator, double p_left, double p_right, Variant& r_result)
+    {
+        switch (p_operator)
+        {
+            case Variant::OP_ADD: r_result = p_left + p_right; return true;
+            case Variant::OP_SUBTRACT: r_result = p_left - p_right; return true;
+            case Variant::OP_MULTIPLY: r_result = p_left * p_right; return true;
+            case Variant::OP_DIVIDE: r_result = p_left / p_right; return true;
+            case Variant::OP_EQUAL: r_result = p_left == p_right; return true;
+            case Variant::OP_NOT_EQUAL: r_result = p_left != p_right; return true;
+            case Variant::OP_LESS: r_result = p_left < p_right; return true;
+            case Variant::OP_LESS_EQUAL: r_result = p_left <= p_right; return true;
+            case Variant::OP_GREATER: r_result = p_left > p_right; return true;
+            case Variant::OP_GREATER_EQUAL: r_result = p_left >= p_right; return true;
+            default: return false;
+        }
+    }
+
+    static bool _evaluate_bool(Variant::Operator p_operator, bool p_left, bool p_right, Variant& r_result)
+    {
+        switch (p_operator)
+        {
+            case Variant::OP_AND: r_result = p_left && p_right; return true;
+            case Variant::OP_OR: r_result = p_left || p_right; return true;
+            case Variant::OP_XOR: r_result = p_left != p_right; return true;
+            case Variant::OP_EQUAL: r_result = p_left == p_right; return true;
+            case Variant::OP_NOT_EQUAL: r_result = p_left != p_right; return true;
+            default: return false;
+        }
+    }
+
+    bool _evaluate_unary(const Variant& p_value)
+    {
+        switch (_left_type)
+        {
+            case Variant::INT:
+            {
+                const int64_t value = p_value;
+                switch (_operator)
+                {
+                    case Variant::OP_NEGATE: _result = int64_t(0 - uint64_t(value)); return true;
+                    case Variant::OP_POSITIVE: _result = value; return true;
+                    case Variant::OP_BIT_NEGATE: _result = ~value; return true;
+                    default: return false;
+                }
+            }
+            case Variant::FLOAT:
+            {
+                const double value = p_value;
+                switch (_operator)
+                {
+                    case Variant::OP_NEGATE: _result = -value; return true;
+                    case Variant::OP_POSITIVE: _result = value; return true;
+                    default: return false;
+                }
+            }
+            case Variant::BOOL:
+            {
+                if (_operator != Variant::OP_NOT)
+                    return false;
+                _result = !bool(p_value);
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    bool _evaluate_binary(const Variant& p_left, const Variant& p_right)
+    {
+        if (_left_type == Variant::INT && _right_type == Variant::INT)
+            return _evaluate_int(_operator, p_left, p_right, _result);
+
+        if (_left_type == Variant::BOOL && _right_type == Variant::BOOL)
+            return _evaluate_bool(_operator, p_left, p_right, _result);
+
+        // Mixed int and float operands are promoted to float, as the engine does
+        return _evaluate_float(_operator, p_left, p_right, _result);
+    }
+
+public:
+    int step(OScriptExecutionContext& p_context) override
+    {
+        const Variant& left = p_context.get_input(0);
+        if (left.get_type() == _left_type)
+        {
+            if (_unary)
+            {
+                if (_evaluate_unary(left))
+                {
+                    p_context.set_output(0, &_result);
+                    return 0;
+                }
+                return _evaluate_variant(p_context, left, Variant());
+            }
+
+            const Variant& right = p_context.get_input(1);
+            if (right.get_type() == _right_type && _evaluate_binary(left, right))
+            {
+                p_context.set_output(0, &_result);
+                return 0;
+            }
+        }
+
+        return OScriptNodeOperatorInstance::step(p_context);
+    }
+
+    /// Returns whether operands of the given types can be evaluated by this instance.
+    /// @param p_unary whether the operator is unary
+    /// @param p_left the left operand type
+    /// @param p_right the right operand type, ignored for unary operators
+    /// @return true if the operand types are handled natively, false otherwise
+    static bool is_specializable(bool p_unary, Variant::Type p_left, Variant::Type p_right)
+    {
+        const auto is_numeric = [](Variant::Type p_type) { return p_type == Variant::INT || p_type == Variant::FLOAT; };
+        if (p_unary)
+            return is_numeric(p_left) || p_left == Variant::BOOL;
+
+        return (is_numeric(p_left) && is_numeric(p_right)) || (p_left == Variant::BOOL && p_right == Variant::BOOL);
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void OScriptNodeOperator::_bind_methods()
@@ -295,6 +451,27 @@ OScriptNodeInstance* OScriptNodeOperator::instantiate()
     return i;
 }
 
+OScriptNodeInstance* OScriptNodeOperator::instantiate_specialized(const Vector<Variant::Type>& p_input_types)
+{
+    const bool unary = _is_unary();
+    const int operands = unary ? 1 : 2;
+    if (p_input_types.size() < operands)
+        return instantiate();
+
+    const Variant::Type left = p_input_types[0];
+    const Variant::Type right = unary ? Variant::NIL : p_input_types[1];
+    if (!OScriptNodeOperatorScalarInstance::is_specializable(unary, left, right))
+        return instantiate();
+
+    OScriptNodeOperatorScalarInstance* i = memnew(OScriptNodeOperatorScalarInstance);
+    i->_node = this;
+    i->_unary = unary;
+    i->_operator = VariantOperators::to_engine(_info.op);
+    i->_left_type = left;
+    i->_right_type = right;
+    return i;
+}
+
 void OScriptNodeOperator::initialize(const OScriptNodeInitContext& p_context)
 {
     ERR_FAIL_COND_MSG(!p_context.user_data, "No data provided to create an Operator node");
@@ -47,6 +47,7 @@ public:
     String get_node_title_color_name() const override { return "math_operations"; }
     String get_icon() const override { return "Translation"; }
     OScriptNodeInstance* instantiate() override;
+    OScriptNodeInstance* instantiate_specialized(const Vector<Variant::Type>& p_input_types) override;
     void initialize(const OScriptNodeInitContext& p_context) override;
     void validate_node_during_build(BuildLog& p_log) const override;
     //~ End OScriptNode Interface
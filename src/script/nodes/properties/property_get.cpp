@@ -40,6 +40,8 @@ class OScriptNodePropertyGetInstance : public OScriptNodeInstance
     }
 
 public:
+    bool is_external_input() const override { return true; }
+
     int step(OScriptExecutionContext& p_context) override
     {
         switch (_call_mode)
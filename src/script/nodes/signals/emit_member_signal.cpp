@@ -23,8 +23,8 @@ class OScriptNodeEmitMemberSignalInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeEmitMemberSignal);
 
-    MethodInfo _method;
-    Array _args;
+    Variant _signal_name;      //! Signal name, resolved at instantiation and passed as the first emit argument
+    int _argument_count{ 0 };  //! Number of signal arguments
 
     Object* _get_call_instance(OScriptExecutionContext& p_context)
     {
@@ -35,25 +35,22 @@ class OScriptNodeEmitMemberSignalInstance : public OScriptNodeInstance
 public:
     int step(OScriptExecutionContext& p_context) override
     {
-        if (!_method.name.is_empty())
+        if (_signal_name.get_type() != Variant::NIL)
         {
             Object* instance = _get_call_instance(p_context);
             if (!instance)
             {
-                ERR_PRINT("Cannot emit signal " + _method.name + " on an invalid target.");
+                ERR_PRINT("Cannot emit signal " + String(_signal_name) + " on an invalid target.");
                 return -1 | STEP_FLAG_END;
             }
 
-            if (!_method.arguments.empty())
-            {
-                if (uint64_t(_args.size()) != _method.arguments.size())
-                    _args.resize(_method.arguments.size());
-
-                for (uint64_t i = 0; i < _method.arguments.size(); i++)
-                    _args[i] = p_context.get_input(i + 2);
-            }
+            // Signal arguments follow the target input pin
+            const Variant** args = static_cast<const Variant**>(alloca(sizeof(Variant*) * (_argument_count + 1)));
+            args[0] = &_signal_name;
+            for (int i = 0; i < _argument_count; i++)
+                args[i + 1] = &p_context.get_input(i + 1);
 
-            instance->emit_signal(_method.name, _args);
+            instance->emit_signal_internal(args, _argument_count + 1);
         }
         return 0;
     }
@@ -163,7 +160,9 @@ OScriptNodeInstance* OScriptNodeEmitMemberSignal::instantiate()
 {
     OScriptNodeEmitMemberSignalInstance* i = memnew(OScriptNodeEmitMemberSignalInstance);
     i->_node = this;
-    i->_method = _method;
+    i->_argument_count = static_cast<int>(_method.arguments.size());
+    if (!_method.name.is_empty())
+        i->_signal_name = StringName(_method.name);
     return i;
 }
 
@@ -26,74 +26,28 @@ class OScriptNodeEmitSignalInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeEmitSignal);
 
-    MethodInfo _signal;
+    Variant _signal_name;   //! Signal name, resolved at instantiation and passed as the first emit argument
+    int _argument_count{ 0 };
 
 public:
     int step(OScriptExecutionContext& p_context) override
     {
-        if (_signal.name.is_empty())
+        if (_signal_name.get_type() == Variant::NIL)
         {
             ERR_PRINT("Emit signal has no signal detail.");
             return 0;
         }
 
-        std::vector<Variant> args;
-        for (size_t i = 0; i < _signal.arguments.size(); i++)
-            args.push_back(p_context.get_input(i));
+        // Emit directly from the input slots, avoids copying arguments on each emission
+        const Variant** args = static_cast<const Variant**>(alloca(sizeof(Variant*) * (_argument_count + 1)));
+        args[0] = &_signal_name;
+        for (int i = 0; i < _argument_count; i++)
+            args[i + 1] = &p_context.get_input(i);
 
-        dispatch(p_context, _signal.name, args);
+        p_context.get_owner()->emit_signal_internal(args, _argument_count + 1);
 
         return 0;
     }
-
-
-    void dispatch(OScriptExecutionContext& p_context, const StringName& p_name, const std::vector<Variant>& p_args)
-    {
-        switch (p_args.size())
-        {
-            case 0:
-                dispatch(p_context, p_name);
-                break;
-            case 1:
-                dispatch(p_context, p_name, p_args[0]);
-                break;
-            case 2:
-                dispatch(p_context, p_name, p_args[0], p_args[1]);
-                break;
-            case 3:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2]);
-                break;
-            case 4:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2], p_args[3]);
-                break;
-            case 5:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2], p_args[3], p_args[4]);
-                break;
-            case 6:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2], p_args[3], p_args[4], p_args[5]);
-                break;
-            case 7:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2], p_args[3], p_args[4], p_args[5], p_args[6]);
-                break;
-            case 8:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2], p_args[3], p_args[4], p_args[5], p_args[6], p_args[7]);
-                break;
-            case 9:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2], p_args[3], p_args[4], p_args[5], p_args[6], p_args[7], p_args[8]);
-                break;
-            case 10:
-                dispatch(p_context, p_name, p_args[0], p_args[1], p_args[2], p_args[3], p_args[4], p_args[5], p_args[6], p_args[7], p_args[8], p_args[9]);
-                break;
-            default:
-                ERR_PRINT("Too many signal arguments, no signal dispatched");
-        }
-    }
-
-    template<typename... Args>
-    void dispatch(OScriptExecutionContext& p_context, const StringName& p_name, const Args&... p_args)
-    {
-        p_context.get_owner()->emit_signal(p_name, p_args...);
-    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,7 +186,11 @@ OScriptNodeInstance* OScriptNodeEmitSignal::instantiate()
 
     Ref<OScriptSignal> signal = get_orchestration()->get_custom_signal(_signal_name);
     if (signal.is_valid())
-        i->_signal = signal->get_method_info();
+    {
+        const MethodInfo& mi = signal->get_method_info();
+        i->_signal_name = StringName(mi.name);
+        i->_argument_count = static_cast<int>(mi.arguments.size());
+    }
 
     return i;
 }
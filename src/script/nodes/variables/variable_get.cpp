@@ -23,23 +23,29 @@ class OScriptNodeVariableGetInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeVariableGet);
     StringName _variable_name;
+    int _variable_index{ -1 };
     bool _validated{ false };
 
 public:
     int step(OScriptExecutionContext& p_context) override
     {
-        OScriptVirtualMachine::Variable* variable = p_context.get_runtime()->get_variable(_variable_name);
-        if (!variable)
+        OScriptVirtualMachine* runtime = p_context.get_runtime();
+        if (_variable_index == -1)
         {
-            p_context.set_error(vformat("Variable '%s' not found.", _variable_name));
-            return -1;
+            // Slot indices are fixed by the script's variable layout, resolve once
+            _variable_index = runtime->get_variable_index(_variable_name);
+            if (_variable_index == -1)
+            {
+                p_context.set_error(vformat("Variable '%s' not found.", _variable_name));
+                return -1;
+            }
         }
 
-        p_context.set_output(0, &variable->value);
+        Variant& output = p_context.get_output(0);
+        runtime->get_variable_value(_variable_index, output);
         if (_validated)
         {
-
-            if (variable->type == Variant::OBJECT && !Object::cast_to<Object>(variable->value))
+            if (runtime->get_variable_slot(_variable_index).type == Variant::OBJECT && !Object::cast_to<Object>(output))
                 return 1;
         }
         return 0;
@@ -24,6 +24,7 @@ class OScriptNodeVariableSetInstance : public OScriptNodeInstance
 {
     DECLARE_SCRIPT_NODE_INSTANCE(OScriptNodeVariableSet);
     StringName _variable_name;
+    int _variable_index{ -1 };
     bool _constant{ false };
 
 public:
@@ -35,30 +36,46 @@ public:
             return -1 | STEP_FLAG_END;
         }
 
-        Variant value = p_context.get_input(0);
+        OScriptVirtualMachine* runtime = p_context.get_runtime();
+        if (_variable_index == -1)
+        {
+            // Slot indices are fixed by the script's variable layout, resolve once
+            _variable_index = runtime->get_variable_index(_variable_name);
+            if (_variable_index == -1)
+            {
+                p_context.set_error(vformat("Variable '%s' not found.", _variable_name));
+                return -1;
+            }
+        }
+
+        const Variant& value = p_context.get_input(0);
 
-        Variant current_value;
-        if (p_context.get_runtime()->get_variable(_variable_name, current_value))
+        const OScriptVariableLayout::Slot& slot = runtime->get_variable_slot(_variable_index);
+        if (slot.typed)
+        {
+            // Unboxed variables convert the value to the declared type
+            if (!runtime->set_variable_value(_variable_index, value))
+            {
+                p_context.set_expected_type_error(0, value.get_type(), slot.type);
+                return -1;
+            }
+        }
+        else
         {
+            Variant current_value;
+            runtime->get_variable_value(_variable_index, current_value);
+
             // Value is currently assigned
             if (!Variant::can_convert(value.get_type(), current_value.get_type()))
             {
                 p_context.set_expected_type_error(0, value.get_type(), current_value.get_type());
                 return -1;
             }
-        }
 
-        if (!p_context.get_runtime()->set_variable(_variable_name, value))
-        {
-            p_context.set_error(vformat("Variable '%s' not found.", _variable_name));
-            return -1;
+            runtime->set_variable_value(_variable_index, value);
         }
 
-        if (!p_context.set_output(0, &value))
-        {
-            p_context.set_error("Failed to set variable value on output stack.");
-            return -1;
-        }
+        runtime->get_variable_value(_variable_index, p_context.get_output(0));
 
         return 0;
     }
@@ -21,7 +21,11 @@
 #include "script/script.h"
 #include "script/serialization/resource_cache.h"
 #include "script/serialization/serialization.h"
+#include "script/vm/dispatch_table.h"
+#include "script/vm/execution_replayer.h"
+#include "script/vm/node_profiler.h"
 #include "script/vm/script_state.h"
+#include "script/vm/variable_layout.h"
 
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
@@ -66,10 +70,14 @@ void register_script_types()
     GDREGISTER_INTERNAL_CLASS(OScriptVariable)
     GDREGISTER_INTERNAL_CLASS(OScriptSignal)
     GDREGISTER_INTERNAL_CLASS(OScriptState)
+    GDREGISTER_INTERNAL_CLASS(OScriptVariableLayout)
+    GDREGISTER_INTERNAL_CLASS(OScriptDispatchTable)
+    GDREGISTER_INTERNAL_CLASS(OScriptNodeProfiler)
     GDREGISTER_INTERNAL_CLASS(OScriptAction)
 
     // Purposely public
     GDREGISTER_CLASS(OScript)
+    GDREGISTER_CLASS(OScriptExecutionReplayer)
 
     // Create the ScriptExtension
     language = memnew(OScriptLanguage);
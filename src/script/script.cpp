@@ -17,12 +17,17 @@
 #include "script/script.h"
 
 #include "common/dictionary_utils.h"
+#include "common/macros.h"
+#include "script/instances/instance_arena.h"
 #include "script/instances/script_instance.h"
 #include "script/instances/script_instance_placeholder.h"
 #include "script/nodes/script_nodes.h"
+#include "script/vm/instance_state.h"
 
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/core/mutex_lock.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
 
 OScript::OScript()
     : Orchestration(this, OT_Script)
@@ -74,6 +79,11 @@ void OScript::_bind_methods()
     ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "graphs", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "_set_graphs",
                  "_get_graphs");
 
+    ClassDB::bind_method(D_METHOD("capture_instance_states"), &OScript::capture_instance_states);
+    ClassDB::bind_method(D_METHOD("restore_instance_states", "data"), &OScript::restore_instance_states);
+    ClassDB::bind_method(D_METHOD("attach_instances", "objects"), &OScript::attach_instances);
+    ClassDB::bind_method(D_METHOD("create_instances", "count"), &OScript::create_instances);
+
     ADD_SIGNAL(MethodInfo("connections_changed", PropertyInfo(Variant::STRING, "caller")));
     ADD_SIGNAL(MethodInfo("functions_changed"));
     ADD_SIGNAL(MethodInfo("variables_changed"));
@@ -126,8 +136,91 @@ bool OScript::placeholder_has(Object* p_object) const
     return _placeholders.has(p_object->get_instance_id());
 }
 
+Ref<OScriptVariableLayout> OScript::get_variable_layout() const
+{
+    MutexLock lock(*_language->lock.ptr());
+    if (!_variable_layout.is_valid() || !_variable_layout->matches(_variables))
+    {
+        // Existing instances keep a reference to the prior layout
+        _variable_layout.instantiate();
+        _variable_layout->build(_variables);
+    }
+    return _variable_layout;
+}
+
+Ref<OScriptDispatchTable> OScript::get_dispatch_table() const
+{
+    MutexLock lock(*_language->lock.ptr());
+    if (!_dispatch_table.is_valid() || !_dispatch_table->matches(_functions, _base_type))
+    {
+        // Existing instances keep a reference to the prior table
+        _dispatch_table.instantiate();
+        _dispatch_table->build(_functions, _base_type);
+    }
+    return _dispatch_table;
+}
+
+String OScript::_get_instance_state_key(Object* p_owner)
+{
+    // Node paths are stable across scene reloads, unlike object identities
+    Node* node = Object::cast_to<Node>(p_owner);
+    return node && node->is_inside_tree() ? String(node->get_path()) : String();
+}
+
+PackedByteArray OScript::capture_instance_states() const
+{
+    LocalVector<Pair<String, const OScriptVirtualMachine*>> instances;
+    {
+        MutexLock lock(*_language->lock.ptr());
+        for (const KeyValue<Object*, OScriptInstance*>& E : _instances)
+            instances.push_back(Pair<String, const OScriptVirtualMachine*>(_get_instance_state_key(E.key), &E.value->_vm));
+    }
+
+    return OScriptInstanceStateCodec::encode(instances);
+}
+
+Error OScript::restore_instance_states(const PackedByteArray& p_data)
+{
+    HashMap<String, OScriptVirtualMachine*> instances;
+    {
+        MutexLock lock(*_language->lock.ptr());
+        for (const KeyValue<Object*, OScriptInstance*>& E : _instances)
+        {
+            const String key = _get_instance_state_key(E.key);
+            if (!key.is_empty())
+                instances[key] = &E.value->_vm;
+        }
+    }
+
+    int restored = 0;
+    return OScriptInstanceStateCodec::decode(p_data, instances, restored);
+}
+
+/// Instances prepared by <code>OScript::attach_instances</code>, taken as the engine attaches the script to each owner
+struct OScriptPreparedInstances
+{
+    const OScript* script{ nullptr };
+    HashMap<Object*, OScriptInstance*> instances;
+};
+
+static thread_local OScriptPreparedInstances* prepared_instances = nullptr;
+
 void* OScript::_instance_create(Object* p_object) const
 {
+    // Instances created in bulk are already constructed and registered
+    if (prepared_instances && prepared_instances->script == this)
+    {
+        const HashMap<Object*, OScriptInstance*>::Iterator E = prepared_instances->instances.find(p_object);
+        if (E)
+        {
+            OScriptInstance* si = E->value;
+            prepared_instances->instances.remove(E);
+
+            si->_script_instance = GDEXTENSION_SCRIPT_INSTANCE_CREATE(&OScriptInstance::INSTANCE_INFO, si);
+            return si->_script_instance;
+        }
+    }
+
     OScriptInstance* si = memnew(OScriptInstance(Ref<Script>(this), _language, p_object));
     {
         MutexLock lock(*_language->lock.ptr());
@@ -147,6 +240,123 @@ void* OScript::_instance_create(Object* p_object) const
     return si->_script_instance;
 }
 
+int OScript::attach_instances(const Array& p_objects)
+{
+    ERR_FAIL_COND_V_MSG(!_can_instantiate(), 0, "Cannot attach a script that cannot be instantiated");
+
+    const StringName base_type = _get_instance_base_type();
+
+    LocalVector<Object*> owners;
+    owners.reserve(p_objects.size());
+    {
+        HashSet<Object*> seen;
+        for (int64_t i = 0; i < p_objects.size(); i++)
+        {
+            Object* owner = p_objects[i];
+            ERR_CONTINUE_MSG(!owner, "Cannot attach a script to a null object");
+            ERR_CONTINUE_MSG(!owner->is_class(base_type), vformat("Cannot attach script to %s, it does not inherit %s", owner->get_class(), base_type));
+            if (!seen.has(owner))
+            {
+                seen.insert(owner);
+                owners.push_back(owner);
+            }
+        }
+    }
+
+    if (owners.is_empty())
+        return 0;
+
+    OScriptPreparedInstances prepared;
+    prepared.script = this;
+    prepared.instances.reserve(owners.size());
+
+    LocalVector<OScriptInstance*> instances;
+
+    {
+        MutexLock lock(*_language->lock.ptr());
+
+        // Owners already running this script keep their instance
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < owners.size(); i++)
+        {
+            if (!_instances.has(owners[i]))
+                owners[count++] = owners[i];
+        }
+        owners.resize(count);
+
+        if (owners.is_empty())
+            return 0;
+
+        // All instances share one allocation, and are constructed and registered under a single lock
+        const Ref<OScriptVariableLayout> layout = get_variable_layout();
+        OScriptInstanceArena* arena = OScriptInstanceArena::create(owners.size(), layout->get_typed_size());
+
+        for (uint32_t i = 0; i < owners.size(); i++)
+        {
+            OScriptInstance* si = new (arena->get_instance_storage(i))
+                OScriptInstance(Ref<Script>(this), _language, owners[i], arena, arena->get_typed_storage(i));
+
+            _instances[owners[i]] = si;
+            prepared.instances[owners[i]] = si;
+            instances.push_back(si);
+        }
+    }
+
+    // Attaching the script calls back into _instance_create, which takes the prepared instance
+    OScriptPreparedInstances* previous = prepared_instances;
+    prepared_instances = &prepared;
+
+    const Ref<Script> script(this);
+    for (Object* owner : owners)
+        owner->set_script(script);
+
+    prepared_instances = previous;
+
+    // Instances the engine did not take are discarded
+    const int attached = static_cast<int>(owners.size() - prepared.instances.size());
+    for (OScriptInstance*& si : instances)
+    {
+        if (prepared.instances.has(si->_owner))
+        {
+            OScriptInstanceArena::destroy(si);
+            si = nullptr;
+        }
+    }
+
+    // Dispatch the "Init Event" once all instances are attached
+    if (has_function("_init"))
+    {
+        for (OScriptInstance* si : instances)
+        {
+            if (!si)
+                continue;
+
+            Variant result;
+            GDExtensionCallError err;
+            si->call("_init", nullptr, 0, &result, &err);
+        }
+    }
+
+    return attached;
+}
+
+Array OScript::create_instances(int p_count)
+{
+    ERR_FAIL_COND_V_MSG(p_count < 0, Array(), "Cannot create a negative number of instances");
+
+    const StringName base_type = _get_instance_base_type();
+    ERR_FAIL_COND_V_MSG(!ClassDB::can_instantiate(base_type), Array(), "Cannot instantiate base type " + base_type);
+
+    Array objects;
+    objects.resize(p_count);
+    for (int i = 0; i < p_count; i++)
+        objects[i] = ClassDB::instantiate(base_type);
+
+    attach_instances(objects);
+
+    return objects;
+}
+
 bool OScript::_instance_has(Object* p_object) const
 {
     return _instances.has(p_object);
@@ -232,21 +442,14 @@ Dictionary OScript::_get_method_info(const StringName& p_method) const
 
 TypedArray<Dictionary> OScript::_get_script_method_list() const
 {
-    TypedArray<Dictionary> results;
-    for (const KeyValue<StringName, Ref<OScriptFunction>>& E : _functions)
-        results.push_back(E.value->to_dict());
-
-    return results;
+    MutexLock lock(*_language->lock.ptr());
+    return _get_reflection().methods;
 }
 
 TypedArray<Dictionary> OScript::_get_script_property_list() const
 {
-    TypedArray<Dictionary> results;
-    for (const KeyValue<StringName, Ref<OScriptVariable>>& E : _variables)
-        if (E.value->is_exported())
-            results.push_back(DictionaryUtils::from_property(E.value->get_info()));
-
-    return results;
+    MutexLock lock(*_language->lock.ptr());
+    return _get_reflection().properties;
 }
 
 bool OScript::_is_tool() const
@@ -271,12 +474,8 @@ bool OScript::_has_script_signal(const StringName& p_signal) const
 
 TypedArray<Dictionary> OScript::_get_script_signal_list() const
 {
-    TypedArray<Dictionary> list;
-
-    for (const KeyValue<StringName, Ref<OScriptSignal>>& E : _signals)
-        list.push_back(DictionaryUtils::from_method(E.value->get_method_info()));
-
-    return list;
+    MutexLock lock(*_language->lock.ptr());
+    return _get_reflection().signals;
 }
 
 bool OScript::_has_property_default_value(const StringName& p_property) const
@@ -290,11 +489,8 @@ bool OScript::_has_property_default_value(const StringName& p_property) const
 
 Variant OScript::_get_property_default_value(const StringName& p_property) const
 {
-    for (const KeyValue<StringName, Ref<OScriptVariable>>& E : _variables)
-        if (E.key.match(p_property))
-            return E.value->get_default_value();
-
-    return {};
+    HashMap<StringName, Ref<OScriptVariable>>::ConstIterator E = _variables.find(p_property);
+    return E ? E->value->get_default_value() : Variant();
 }
 
 void OScript::_update_exports()
@@ -370,3 +566,57 @@ void OScript::_update_exports_down(bool p_base_exports_changed)
     // todo: add inheriters_cache
 }
 
+const OScript::ReflectionSnapshot& OScript::_get_reflection() const
+{
+    if (_reflection_valid)
+        return _reflection;
+
+    _reflection = ReflectionSnapshot();
+
+    // Members emit "changed" when edited, while additions, removals, and renames are signaled by the script
+    OScript* self = const_cast<OScript*>(this);
+    const Callable invalidate = callable_mp(self, &OScript::_invalidate_reflection);
+    OCONNECT(self, "functions_changed", invalidate);
+    OCONNECT(self, "variables_changed", invalidate);
+    OCONNECT(self, "signals_changed", invalidate);
+
+    for (const KeyValue<StringName, Ref<OScriptFunction>>& E : _functions)
+    {
+        _reflection.methods.push_back(E.value->to_dict());
+        OCONNECT(E.value, "changed", invalidate);
+    }
+
+    for (const KeyValue<StringName, Ref<OScriptVariable>>& E : _variables)
+    {
+        if (E.value->is_exported())
+            _reflection.properties.push_back(DictionaryUtils::from_property(E.value->get_info()));
+
+        OCONNECT(E.value, "changed", invalidate);
+    }
+
+    for (const KeyValue<StringName, Ref<OScriptSignal>>& E : _signals)
+    {
+        _reflection.signals.push_back(DictionaryUtils::from_method(E.value->get_method_info()));
+        OCONNECT(E.value, "changed", invalidate);
+    }
+
+    // Callers share the snapshot's arrays, so neither they nor their entries may be modified
+    const auto make_read_only = [](TypedArray<Dictionary>& r_list) {
+        for (int i = 0; i < r_list.size(); i++)
+            Dictionary(r_list[i]).make_read_only();
+        r_list.make_read_only();
+    };
+    make_read_only(_reflection.methods);
+    make_read_only(_reflection.properties);
+    make_read_only(_reflection.signals);
+
+    _reflection_valid = true;
+    return _reflection;
+}
+
+void OScript::_invalidate_reflection()
+{
+    MutexLock lock(*_language->lock.ptr());
+    _reflection_valid = false;
+}
+
@@ -19,6 +19,8 @@
 
 #include "orchestration/orchestration.h"
 #include "script/instances/instance_base.h"
+#include "script/vm/dispatch_table.h"
+#include "script/vm/variable_layout.h"
 
 #include <gdextension_interface.h>
 #include <godot_cpp/classes/script_extension.hpp>
@@ -50,6 +52,20 @@ private:
     // these are mutable because they're modified within const function callbacks
     mutable HashMap<Object*, OScriptInstance*> _instances;
     mutable HashMap<uint64_t, OScriptPlaceHolderInstance*> _placeholders;
+    mutable Ref<OScriptVariableLayout> _variable_layout;  //! Runtime variable layout shared by instances
+    mutable Ref<OScriptDispatchTable> _dispatch_table;    //! Runtime method dispatch table shared by instances
+
+    /// Reflection metadata queried by the engine, built on demand and replaced when members change.
+    /// Callers share the arrays of a snapshot, which are made read-only once built.
+    struct ReflectionSnapshot
+    {
+        TypedArray<Dictionary> methods;                    //! Script method list
+        TypedArray<Dictionary> properties;                 //! Exported property list
+        TypedArray<Dictionary> signals;                    //! Script signal list
+    };
+
+    mutable ReflectionSnapshot _reflection;                //! Current reflection snapshot
+    mutable bool _reflection_valid{ false };               //! Whether the reflection snapshot is current
 
 protected:
     // Godot bindings
@@ -65,11 +81,23 @@ protected:
     TypedArray<OScriptGraph> _get_graphs() const { return _get_graphs_internal(); }
     void _set_graphs(const TypedArray<OScriptGraph>& p_graphs) { _set_graphs_internal(p_graphs); }
     TypedArray<OScriptFunction> _get_functions() const { return _get_functions_internal(); }
-    void _set_functions(const TypedArray<OScriptFunction>& p_functions) { _set_functions_internal(p_functions); }
+    void _set_functions(const TypedArray<OScriptFunction>& p_functions)
+    {
+        _set_functions_internal(p_functions);
+        _invalidate_reflection();
+    }
     TypedArray<OScriptVariable> _get_variables() const { return _get_variables_internal(); }
-    void _set_variables(const TypedArray<OScriptVariable>& p_variables) { _set_variables_internal(p_variables); }
+    void _set_variables(const TypedArray<OScriptVariable>& p_variables)
+    {
+        _set_variables_internal(p_variables);
+        _invalidate_reflection();
+    }
     TypedArray<OScriptSignal> _get_signals() const { return _get_signals_internal(); }
-    void _set_signals(const TypedArray<OScriptSignal>& p_signals) { _set_signals_internal(p_signals); }
+    void _set_signals(const TypedArray<OScriptSignal>& p_signals)
+    {
+        _set_signals_internal(p_signals);
+        _invalidate_reflection();
+    }
     //~ End Serialization API
 
     /// Updates the exported values
@@ -88,6 +116,19 @@ protected:
     /// @param p_base_exports_changed whether the base class exports changed
     void _update_exports_down(bool p_base_exports_changed);
 
+    /// Get the reflection snapshot, building it if the members changed since it was last built.
+    /// The caller must hold the language lock.
+    /// @return the reflection snapshot
+    const ReflectionSnapshot& _get_reflection() const;
+
+    /// Get the key that identifies an instance's state across scene reloads
+    /// @param p_owner the instance owner
+    /// @return the owner's node path, or an empty string if the owner cannot be identified
+    static String _get_instance_state_key(Object* p_owner);
+
+    /// Discards the reflection snapshot, called when functions, variables, or signals change
+    void _invalidate_reflection();
+
 public:
     OScript();
 
@@ -130,6 +171,37 @@ public:
     String _get_class_icon_path() const override;
     //~ End ScriptExtension overrides
 
+    /// Get the runtime variable layout, rebuilt if the variable declarations have changed.
+    /// @return the variable layout shared by all instances of this script
+    Ref<OScriptVariableLayout> get_variable_layout() const;
+
+    /// Attaches this script to many objects at once. The instances are allocated together, their variables are
+    /// copied from a pre-initialized block, they are registered under a single lock, and the "Init Event" is
+    /// dispatched once all instances have been attached. Objects already running this script are skipped.
+    /// @param p_objects the objects, each must inherit the script's base type
+    /// @return the number of objects the script was attached to
+    int attach_instances(const Array& p_objects);
+
+    /// Creates objects of the script's base type with this script attached, using <code>attach_instances</code>.
+    /// @param p_count the number of objects to create
+    /// @return the created objects
+    Array create_instances(int p_count);
+
+    /// Captures the variable values of all instances of this script into a single blob. Only instances
+    /// whose owner is a node inside the scene tree are captured, keyed by the node's path.
+    /// @return the encoded instance states
+    PackedByteArray capture_instance_states() const;
+
+    /// Restores variable values captured by <code>capture_instance_states</code>, applying each record
+    /// to the instance whose owner has the same node path. Records without such an instance are skipped.
+    /// @param p_data the encoded instance states
+    /// @return the error code, <code>OK</code> if successful
+    Error restore_instance_states(const PackedByteArray& p_data);
+
+    /// Get the runtime method dispatch table, rebuilt if the functions or base type have changed.
+    /// @return the dispatch table shared by all instances of this script
+    Ref<OScriptDispatchTable> get_dispatch_table() const;
+
     /// Get the underlying script's language
     /// @return the script language instance
     ScriptLanguage* get_language() const { return _get_language(); }
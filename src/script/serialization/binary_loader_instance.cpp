@@ -60,6 +60,28 @@ String OScriptBinaryResourceLoaderInstance::_read_string()
     return _string_map[id];
 }
 
+Error OScriptBinaryResourceLoaderInstance::_read_string_index(StringName& r_value)
+{
+    const uint32_t index = _file->get_32();
+    ERR_FAIL_UNSIGNED_INDEX_V_MSG(index, static_cast<uint32_t>(_string_map.size()), ERR_FILE_CORRUPT, "Invalid string table index");
+
+    r_value = _string_map[index];
+    return OK;
+}
+
+String OScriptBinaryResourceLoaderInstance::_read_resource_type()
+{
+    // Format 4 - resource types are written by string table index
+    if (_version >= 4)
+    {
+        StringName type;
+        if (_read_string_index(type) != OK)
+            return {};
+        return type;
+    }
+    return _read_unicode_string(_file);
+}
+
 Error OScriptBinaryResourceLoaderInstance::_parse_variant(Variant& r_val)
 {
     uint32_t variant_type = _file->get_32();
@@ -289,6 +311,20 @@ Error OScriptBinaryResourceLoaderInstance::_parse_variant(Variant& r_val)
             r_val = StringName(_read_unicode_string(_file));
             break;
         }
+        case VARIANT_STRING_INDEX:
+        {
+            StringName value;
+            ERR_FAIL_COND_V(_read_string_index(value) != OK, ERR_FILE_CORRUPT);
+            r_val = String(value);
+            break;
+        }
+        case VARIANT_STRING_NAME_INDEX:
+        {
+            StringName value;
+            ERR_FAIL_COND_V(_read_string_index(value) != OK, ERR_FILE_CORRUPT);
+            r_val = value;
+            break;
+        }
         case VARIANT_NODE_PATH:
         {
             [[maybe_unused]] bool absolute;
@@ -448,6 +484,98 @@ Error OScriptBinaryResourceLoaderInstance::_parse_variant(Variant& r_val)
             r_val = a;
             break;
         }
+        case VARIANT_DICTIONARY_TABLE:
+        {
+            const uint32_t row_count = _file->get_32();
+            const uint32_t column_count = _file->get_32();
+
+            Vector<String> columns;
+            for (uint32_t i = 0; i < column_count; i++)
+            {
+                StringName column;
+                ERR_FAIL_COND_V(_read_string_index(column) != OK, ERR_FILE_CORRUPT);
+                columns.push_back(column);
+            }
+
+            Vector<Dictionary> rows;
+            rows.resize(row_count);
+
+            const uint32_t bitmap_size = (row_count + 7) / 8;
+
+            PackedByteArray bitmap;
+            bitmap.resize(bitmap_size);
+
+            for (const String& column : columns)
+            {
+                _file->get_buffer(bitmap.ptrw(), bitmap_size);
+                _advance_padding(_file, bitmap_size);
+
+                const uint8_t* present = bitmap.ptr();
+                for (uint32_t i = 0; i < row_count; i++)
+                {
+                    if (!(present[i >> 3] & (1 << (i & 7))))
+                        continue;
+
+                    Variant value;
+                    Error err = _parse_variant(value);
+                    ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Error when trying to parse dictionary table value");
+
+                    rows.write[i][column] = value;
+                }
+            }
+
+            Array a;
+            a.resize(row_count);
+            for (uint32_t i = 0; i < row_count; i++)
+                a[i] = rows[i];
+
+            r_val = a;
+            break;
+        }
+        case VARIANT_INT_ARRAY:
+        {
+            const uint32_t size = _file->get_32();
+            const uint32_t width = _file->get_32();
+            ERR_FAIL_COND_V_MSG(width != 4 && width != 8, ERR_FILE_CORRUPT, "Invalid integer array width");
+
+            Array a;
+            a.resize(size);
+
+            // Values are read in bulk when the file matches the native little-endian layout
+            if (width == 8)
+            {
+                PackedInt64Array values;
+                values.resize(size);
+                if (_file->is_big_endian())
+                {
+                    for (uint32_t i = 0; i < size; i++)
+                        values[i] = static_cast<int64_t>(_file->get_64());
+                }
+                else
+                    _file->get_buffer(reinterpret_cast<uint8_t*>(values.ptrw()), size * sizeof(int64_t));
+
+                for (uint32_t i = 0; i < size; i++)
+                    a[i] = values[i];
+            }
+            else
+            {
+                PackedInt32Array values;
+                values.resize(size);
+                if (_file->is_big_endian())
+                {
+                    for (uint32_t i = 0; i < size; i++)
+                        values[i] = static_cast<int32_t>(_file->get_32());
+                }
+                else
+                    _file->get_buffer(reinterpret_cast<uint8_t*>(values.ptrw()), size * sizeof(int32_t));
+
+                for (uint32_t i = 0; i < size; i++)
+                    a[i] = values[i];
+            }
+
+            r_val = a;
+            break;
+        }
         case VARIANT_PACKED_BYTE_ARRAY:
         {
             uint32_t size = _file->get_32();
@@ -677,7 +805,7 @@ Error OScriptBinaryResourceLoaderInstance::rename_dependencies(const Ref<FileAcc
     fw->store_32(use_real64);
 
     uint32_t version = p_file->get_32();
-    if (version > FORMAT_VERSION)
+    if (version > BINARY_FORMAT_VERSION)
     {
         fw.unref();
         {
@@ -689,7 +817,7 @@ Error OScriptBinaryResourceLoaderInstance::rename_dependencies(const Ref<FileAcc
         ERR_FAIL_V_MSG(
             ERR_FILE_UNRECOGNIZED,
             vformat("File '%s' cannot be loaded, it uses a format version (%d) which is not supported by the plugin version (%d)",
-                local_path, version, OScriptResourceFormatInstance::FORMAT_VERSION));
+                local_path, version, BINARY_FORMAT_VERSION));
     }
     fw->store_32(version);
 
@@ -825,14 +953,14 @@ void OScriptBinaryResourceLoaderInstance::open(const Ref<FileAccess>& p_file, bo
     // Read the file format version
     _version = _file->get_32();
 
-    if (_version > FORMAT_VERSION)
+    if (_version > BINARY_FORMAT_VERSION)
     {
         _file.unref();
         ERR_FAIL_MSG(vformat(
             "File '%s' cannot be loaded, it uses a format (version %d) that is newer than the current version (%d).",
             _local_path,
             _version,
-            FORMAT_VERSION));
+            BINARY_FORMAT_VERSION));
     }
 
     uint32_t major = _file->get_32();
@@ -854,8 +982,18 @@ void OScriptBinaryResourceLoaderInstance::open(const Ref<FileAccess>& p_file, bo
             _script_class = _read_unicode_string(_file);
     }
 
+    // Binary format 4 stores the model version in the first reserved field, as the container version
+    // advances independently. Earlier files used the same version for both.
+    uint32_t reserved_start = 0;
+    _model_version = _version;
+    if (_version >= 4)
+    {
+        _model_version = _file->get_32();
+        reserved_start = 1;
+    }
+
     // Skip reserved fields
-    for (uint32_t i = 0; i < RESERVED_FIELDS; i++)
+    for (uint32_t i = reserved_start; i < RESERVED_FIELDS; i++)
         [[maybe_unused]] uint32_t x = _file->get_32();
 
     // If resources aren't to be loaded, don't load them
@@ -991,7 +1129,7 @@ Error OScriptBinaryResourceLoaderInstance::load()
         _file->seek(_internal_resources[i].offset);
 
         // Read the resource type
-        String type = _read_unicode_string(_file);
+        String type = _read_resource_type();
 
         Ref<Resource> res;
         #if GODOT_VERSION >= 0x040400
@@ -1136,7 +1274,7 @@ PackedStringArray OScriptBinaryResourceLoaderInstance::get_classes_used(const Re
         for(int i = 0; i < _internal_resources.size(); i++)
         {
             p_file->seek(_internal_resources[i].offset);
-            String type = _read_unicode_string(_file);
+            String type = _read_resource_type();
             ERR_FAIL_COND_V(p_file->get_error() != OK, {});
             if (type != String())
                 classes.push_back(type);
@@ -1149,6 +1287,7 @@ OScriptBinaryResourceLoaderInstance::OScriptBinaryResourceLoaderInstance()
 {
     _error = OK;
     _version = 0;
+    _model_version = 0;
     _godot_version = 0;
     _uid = ResourceUID::INVALID_ID;
     _cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE;
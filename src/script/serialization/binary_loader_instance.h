@@ -61,7 +61,8 @@ class OScriptBinaryResourceLoaderInstance : protected OScriptResourceBinaryForma
     String _resource_path;                                 //! The resource path
     String _type;                                          //! The resource type
     String _script_class;                                  //! The script class
-    uint32_t _version;                                     //! The resource file format version
+    uint32_t _version;                                     //! The binary container format version
+    uint32_t _model_version;                               //! The orchestration model format version
     uint64_t _godot_version;                               //! The Godot version used to save the resource last
     uint64_t _uid;                                         //! The resource's unique identifier
     Vector<char> _string_buffer;                           //! The string buffer
@@ -88,6 +89,15 @@ class OScriptBinaryResourceLoaderInstance : protected OScriptResourceBinaryForma
     /// @return the string value
     String _read_string();
 
+    /// Read a string table entry by index
+    /// @param r_value the string table entry
+    /// @return OK if the index is valid, ERR_FILE_CORRUPT otherwise
+    Error _read_string_index(StringName& r_value);
+
+    /// Read the type name of an internal resource
+    /// @return the resource type name
+    String _read_resource_type();
+
     /// Parse the variant from the file stream
     /// @param r_value the returned parsed variant value
     /// @return parser error code, OK if the parse was successful
@@ -33,32 +33,32 @@ bool OScriptBinaryResourceSaverInstance::NonPersistentKey::operator<(const NonPe
     return base == p_key.base ? property < p_key.property : base < p_key.base;
 }
 
-void OScriptBinaryResourceSaverInstance::_pad_buffer(Ref<FileAccess> p_file, int p_size)
+void OScriptBinaryResourceSaverInstance::_pad_buffer(OScriptBinaryWriter& p_writer, int p_size)
 {
     const int extra = 4 - (p_size % 4);
     if (extra < 4)
     {
         for (int i = 0; i < extra; i++)
-            p_file->store_8(0); // pad to 32 bytes
+            p_writer.store_8(0); // pad to 32 bytes
     }
 }
 
 void OScriptBinaryResourceSaverInstance::_write_variant(
-    const Ref<FileAccess>& p_file, const Variant& p_value, HashMap<Ref<Resource>, int>& p_resource_map,
+    OScriptBinaryWriter& p_writer, const Variant& p_value, HashMap<Ref<Resource>, int>& p_resource_map,
     HashMap<Ref<Resource>, int>& p_external_resources, HashMap<StringName, int>& p_string_map, const PropertyInfo& p_hint)
 {
 switch (p_value.get_type())
     {
         case Variant::NIL:
         {
-            p_file->store_32(VARIANT_NIL);
+            p_writer.store_32(VARIANT_NIL);
             // Do not store anything for null values
             break;
         }
         case Variant::BOOL:
         {
-            p_file->store_32(VARIANT_BOOL);
-            p_file->store_32(bool(p_value));
+            p_writer.store_32(VARIANT_BOOL);
+            p_writer.store_32(bool(p_value));
             break;
         }
         case Variant::INT:
@@ -66,13 +66,13 @@ switch (p_value.get_type())
             int64_t val = p_value;
             if (val > 0x7FFFFFFF || val < -(int64_t)0x80000000)
             {
-                p_file->store_32(VARIANT_INT64);
-                p_file->store_64(val);
+                p_writer.store_32(VARIANT_INT64);
+                p_writer.store_64(val);
             }
             else
             {
-                p_file->store_32(VARIANT_INT);
-                p_file->store_32(int32_t(p_value));
+                p_writer.store_32(VARIANT_INT);
+                p_writer.store_32(int32_t(p_value));
             }
             break;
         }
@@ -82,425 +82,453 @@ switch (p_value.get_type())
             float fl = d;
             if (double(fl) != d)
             {
-                p_file->store_32(VARIANT_DOUBLE);
-                p_file->store_double(d);
+                p_writer.store_32(VARIANT_DOUBLE);
+                p_writer.store_double(d);
             }
             else
             {
-                p_file->store_32(VARIANT_FLOAT);
-                p_file->store_float(fl);
+                p_writer.store_32(VARIANT_FLOAT);
+                p_writer.store_float(fl);
             }
             break;
         }
         case Variant::STRING:
         {
-            p_file->store_32(VARIANT_STRING);
-            _save_unicode_string(p_file, String(p_value));
+            const String value = p_value;
+            if (value.length() <= static_cast<int64_t>(MAX_INTERNED_STRING_LENGTH) && p_string_map.has(value))
+            {
+                p_writer.store_32(VARIANT_STRING_INDEX);
+                p_writer.store_32(p_string_map[value]);
+                break;
+            }
+
+            p_writer.store_32(VARIANT_STRING);
+            _save_unicode_string(p_writer, value);
             break;
         }
         case Variant::RECT2:
         {
-            p_file->store_32(VARIANT_RECT2);
+            p_writer.store_32(VARIANT_RECT2);
             Rect2 val = p_value;
-            p_file->store_real(val.position.x);
-            p_file->store_real(val.position.y);
-            p_file->store_real(val.size.x);
-            p_file->store_real(val.size.y);
+            p_writer.store_real(val.position.x);
+            p_writer.store_real(val.position.y);
+            p_writer.store_real(val.size.x);
+            p_writer.store_real(val.size.y);
             break;
         }
         case Variant::RECT2I:
         {
-            p_file->store_32(VARIANT_RECT2I);
+            p_writer.store_32(VARIANT_RECT2I);
             Rect2i val = p_value;
-            p_file->store_32(val.position.x);
-            p_file->store_32(val.position.y);
-            p_file->store_32(val.size.x);
-            p_file->store_32(val.size.y);
+            p_writer.store_32(val.position.x);
+            p_writer.store_32(val.position.y);
+            p_writer.store_32(val.size.x);
+            p_writer.store_32(val.size.y);
             break;
         }
         case Variant::VECTOR2:
         {
-            p_file->store_32(VARIANT_VECTOR2);
+            p_writer.store_32(VARIANT_VECTOR2);
             Vector2 val = p_value;
-            p_file->store_real(val.x);
-            p_file->store_real(val.y);
+            p_writer.store_real(val.x);
+            p_writer.store_real(val.y);
             break;
         }
         case Variant::VECTOR2I:
         {
-            p_file->store_32(VARIANT_VECTOR2I);
+            p_writer.store_32(VARIANT_VECTOR2I);
             Vector2i val = p_value;
-            p_file->store_32(val.x);
-            p_file->store_32(val.y);
+            p_writer.store_32(val.x);
+            p_writer.store_32(val.y);
             break;
         }
         case Variant::VECTOR3:
         {
-            p_file->store_32(VARIANT_VECTOR3);
+            p_writer.store_32(VARIANT_VECTOR3);
             Vector3 val = p_value;
-            p_file->store_real(val.x);
-            p_file->store_real(val.y);
-            p_file->store_real(val.z);
+            p_writer.store_real(val.x);
+            p_writer.store_real(val.y);
+            p_writer.store_real(val.z);
             break;
         }
         case Variant::VECTOR3I:
         {
-            p_file->store_32(VARIANT_VECTOR3I);
+            p_writer.store_32(VARIANT_VECTOR3I);
             Vector3i val = p_value;
-            p_file->store_32(val.x);
-            p_file->store_32(val.y);
-            p_file->store_32(val.z);
+            p_writer.store_32(val.x);
+            p_writer.store_32(val.y);
+            p_writer.store_32(val.z);
             break;
         }
         case Variant::VECTOR4:
         {
-            p_file->store_32(VARIANT_VECTOR4);
+            p_writer.store_32(VARIANT_VECTOR4);
             Vector4 val = p_value;
-            p_file->store_real(val.x);
-            p_file->store_real(val.y);
-            p_file->store_real(val.z);
-            p_file->store_real(val.w);
+            p_writer.store_real(val.x);
+            p_writer.store_real(val.y);
+            p_writer.store_real(val.z);
+            p_writer.store_real(val.w);
             break;
         }
         case Variant::VECTOR4I:
         {
-            p_file->store_32(VARIANT_VECTOR4I);
+            p_writer.store_32(VARIANT_VECTOR4I);
             Vector4i val = p_value;
-            p_file->store_32(val.x);
-            p_file->store_32(val.y);
-            p_file->store_32(val.z);
-            p_file->store_32(val.w);
+            p_writer.store_32(val.x);
+            p_writer.store_32(val.y);
+            p_writer.store_32(val.z);
+            p_writer.store_32(val.w);
             break;
         }
         case Variant::PLANE:
         {
-            p_file->store_32(VARIANT_PLANE);
+            p_writer.store_32(VARIANT_PLANE);
             Plane val = p_value;
-            p_file->store_real(val.normal.x);
-            p_file->store_real(val.normal.y);
-            p_file->store_real(val.normal.z);
-            p_file->store_real(val.d);
+            p_writer.store_real(val.normal.x);
+            p_writer.store_real(val.normal.y);
+            p_writer.store_real(val.normal.z);
+            p_writer.store_real(val.d);
             break;
         }
         case Variant::QUATERNION:
         {
-            p_file->store_32(VARIANT_QUATERNION);
+            p_writer.store_32(VARIANT_QUATERNION);
             Quaternion val = p_value;
-            p_file->store_real(val.x);
-            p_file->store_real(val.y);
-            p_file->store_real(val.z);
-            p_file->store_real(val.w);
+            p_writer.store_real(val.x);
+            p_writer.store_real(val.y);
+            p_writer.store_real(val.z);
+            p_writer.store_real(val.w);
             break;
         }
         case Variant::AABB:
         {
-            p_file->store_32(VARIANT_AABB);
+            p_writer.store_32(VARIANT_AABB);
             AABB val = p_value;
-            p_file->store_real(val.position.x);
-            p_file->store_real(val.position.y);
-            p_file->store_real(val.position.z);
-            p_file->store_real(val.size.x);
-            p_file->store_real(val.size.y);
-            p_file->store_real(val.size.z);
+            p_writer.store_real(val.position.x);
+            p_writer.store_real(val.position.y);
+            p_writer.store_real(val.position.z);
+            p_writer.store_real(val.size.x);
+            p_writer.store_real(val.size.y);
+            p_writer.store_real(val.size.z);
             break;
         }
         case Variant::TRANSFORM2D:
         {
-            p_file->store_32(VARIANT_TRANSFORM2D);
+            p_writer.store_32(VARIANT_TRANSFORM2D);
             Transform2D val = p_value;
-            p_file->store_real(val.columns[0].x);
-            p_file->store_real(val.columns[0].y);
-            p_file->store_real(val.columns[1].x);
-            p_file->store_real(val.columns[1].y);
-            p_file->store_real(val.columns[2].x);
-            p_file->store_real(val.columns[2].y);
+            p_writer.store_real(val.columns[0].x);
+            p_writer.store_real(val.columns[0].y);
+            p_writer.store_real(val.columns[1].x);
+            p_writer.store_real(val.columns[1].y);
+            p_writer.store_real(val.columns[2].x);
+            p_writer.store_real(val.columns[2].y);
             break;
         }
         case Variant::BASIS:
         {
-            p_file->store_32(VARIANT_BASIS);
+            p_writer.store_32(VARIANT_BASIS);
             Basis val = p_value;
-            p_file->store_real(val.rows[0].x);
-            p_file->store_real(val.rows[0].y);
-            p_file->store_real(val.rows[0].z);
-            p_file->store_real(val.rows[1].x);
-            p_file->store_real(val.rows[1].y);
-            p_file->store_real(val.rows[1].z);
-            p_file->store_real(val.rows[2].x);
-            p_file->store_real(val.rows[2].y);
-            p_file->store_real(val.rows[2].z);
+            p_writer.store_real(val.rows[0].x);
+            p_writer.store_real(val.rows[0].y);
+            p_writer.store_real(val.rows[0].z);
+            p_writer.store_real(val.rows[1].x);
+            p_writer.store_real(val.rows[1].y);
+            p_writer.store_real(val.rows[1].z);
+            p_writer.store_real(val.rows[2].x);
+            p_writer.store_real(val.rows[2].y);
+            p_writer.store_real(val.rows[2].z);
             break;
         }
         case Variant::TRANSFORM3D:
         {
-            p_file->store_32(VARIANT_TRANSFORM3D);
+            p_writer.store_32(VARIANT_TRANSFORM3D);
             Transform3D val = p_value;
-            p_file->store_real(val.basis.rows[0].x);
-            p_file->store_real(val.basis.rows[0].y);
-            p_file->store_real(val.basis.rows[0].z);
-            p_file->store_real(val.basis.rows[1].x);
-            p_file->store_real(val.basis.rows[1].y);
-            p_file->store_real(val.basis.rows[1].z);
-            p_file->store_real(val.basis.rows[2].x);
-            p_file->store_real(val.basis.rows[2].y);
-            p_file->store_real(val.basis.rows[2].z);
-            p_file->store_real(val.origin.x);
-            p_file->store_real(val.origin.y);
-            p_file->store_real(val.origin.z);
+            p_writer.store_real(val.basis.rows[0].x);
+            p_writer.store_real(val.basis.rows[0].y);
+            p_writer.store_real(val.basis.rows[0].z);
+            p_writer.store_real(val.basis.rows[1].x);
+            p_writer.store_real(val.basis.rows[1].y);
+            p_writer.store_real(val.basis.rows[1].z);
+            p_writer.store_real(val.basis.rows[2].x);
+            p_writer.store_real(val.basis.rows[2].y);
+            p_writer.store_real(val.basis.rows[2].z);
+            p_writer.store_real(val.origin.x);
+            p_writer.store_real(val.origin.y);
+            p_writer.store_real(val.origin.z);
             break;
         }
         case Variant::PROJECTION:
         {
-            p_file->store_32(VARIANT_PROJECTION);
+            p_writer.store_32(VARIANT_PROJECTION);
             Projection val = p_value;
-            p_file->store_real(val.columns[0].x);
-            p_file->store_real(val.columns[0].y);
-            p_file->store_real(val.columns[0].z);
-            p_file->store_real(val.columns[0].w);
-            p_file->store_real(val.columns[1].x);
-            p_file->store_real(val.columns[1].y);
-            p_file->store_real(val.columns[1].z);
-            p_file->store_real(val.columns[1].w);
-            p_file->store_real(val.columns[2].x);
-            p_file->store_real(val.columns[2].y);
-            p_file->store_real(val.columns[2].z);
-            p_file->store_real(val.columns[2].w);
-            p_file->store_real(val.columns[3].x);
-            p_file->store_real(val.columns[3].y);
-            p_file->store_real(val.columns[3].z);
-            p_file->store_real(val.columns[3].w);
+            p_writer.store_real(val.columns[0].x);
+            p_writer.store_real(val.columns[0].y);
+            p_writer.store_real(val.columns[0].z);
+            p_writer.store_real(val.columns[0].w);
+            p_writer.store_real(val.columns[1].x);
+            p_writer.store_real(val.columns[1].y);
+            p_writer.store_real(val.columns[1].z);
+            p_writer.store_real(val.columns[1].w);
+            p_writer.store_real(val.columns[2].x);
+            p_writer.store_real(val.columns[2].y);
+            p_writer.store_real(val.columns[2].z);
+            p_writer.store_real(val.columns[2].w);
+            p_writer.store_real(val.columns[3].x);
+            p_writer.store_real(val.columns[3].y);
+            p_writer.store_real(val.columns[3].z);
+            p_writer.store_real(val.columns[3].w);
             break;
         }
         case Variant::COLOR:
         {
-            p_file->store_32(VARIANT_COLOR);
+            p_writer.store_32(VARIANT_COLOR);
             Color val = p_value;
             // Color are always floats
-            p_file->store_float(val.r);
-            p_file->store_float(val.g);
-            p_file->store_float(val.b);
-            p_file->store_float(val.a);
+            p_writer.store_float(val.r);
+            p_writer.store_float(val.g);
+            p_writer.store_float(val.b);
+            p_writer.store_float(val.a);
             break;
         }
         case Variant::STRING_NAME:
         {
-            p_file->store_32(VARIANT_STRING_NAME);
-            _save_unicode_string(p_file, String(p_value));
+            const StringName value = p_value;
+            if (p_string_map.has(value))
+            {
+                p_writer.store_32(VARIANT_STRING_NAME_INDEX);
+                p_writer.store_32(p_string_map[value]);
+                break;
+            }
+
+            p_writer.store_32(VARIANT_STRING_NAME);
+            _save_unicode_string(p_writer, String(p_value));
             break;
         }
         case Variant::NODE_PATH:
         {
-            p_file->store_32(VARIANT_NODE_PATH);
+            p_writer.store_32(VARIANT_NODE_PATH);
             NodePath np = p_value;
-            p_file->store_16(np.get_name_count());
+            p_writer.store_16(np.get_name_count());
             uint16_t snc = np.get_subname_count();
             if (np.is_absolute())
                 snc |= 0x8000;
 
-            p_file->store_16(snc);
+            p_writer.store_16(snc);
             for (int i = 0; i < np.get_name_count(); i++)
             {
                 if (_string_map.has(np.get_name(i)))
-                    p_file->store_32(_string_map[np.get_name(i)]);
+                    p_writer.store_32(_string_map[np.get_name(i)]);
                 else
-                    _save_unicode_string(p_file, np.get_name(i), true);
+                    _save_unicode_string(p_writer, np.get_name(i), true);
             }
             for (int i = 0; i < np.get_subname_count(); i++)
             {
                 if (_string_map.has(np.get_subname(i)))
-                    p_file->store_32(_string_map[np.get_subname(i)]);
+                    p_writer.store_32(_string_map[np.get_subname(i)]);
                 else
-                    _save_unicode_string(p_file, np.get_subname(i), true);
+                    _save_unicode_string(p_writer, np.get_subname(i), true);
             }
             break;
         }
         case Variant::RID:
         {
-            p_file->store_32(VARIANT_RID);
+            p_writer.store_32(VARIANT_RID);
             WARN_PRINT("Cannot save RIDs (resource identifiers)");
             RID val = p_value;
-            p_file->store_32(val.get_id());
+            p_writer.store_32(val.get_id());
             break;
         }
         case Variant::OBJECT:
         {
-            p_file->store_32(VARIANT_OBJECT);
+            p_writer.store_32(VARIANT_OBJECT);
             Ref<Resource> res = p_value;
             if (res.is_null() || res->get_meta("_skip_save_", false))
             {
                 // Object is empty
-                p_file->store_32(OBJECT_EMPTY);
+                p_writer.store_32(OBJECT_EMPTY);
                 return;
             }
 
             if (!_is_resource_built_in(res))
             {
-                p_file->store_32(OBJECT_EXTERNAL_RESOURCE_INDEX);
-                p_file->store_32(p_external_resources[res]);
+                p_writer.store_32(OBJECT_EXTERNAL_RESOURCE_INDEX);
+                p_writer.store_32(p_external_resources[res]);
             }
             else
             {
                 if (!p_resource_map.has(res))
                 {
-                    p_file->store_32(OBJECT_EMPTY);
+                    p_writer.store_32(OBJECT_EMPTY);
                     ERR_FAIL_MSG("Resource was not pre-cached, most likely a circular resource problem.");
                 }
 
-                p_file->store_32(OBJECT_INTERNAL_RESOURCE);
-                p_file->store_32(p_resource_map[res]);
+                p_writer.store_32(OBJECT_INTERNAL_RESOURCE);
+                p_writer.store_32(p_resource_map[res]);
             }
             break;
         }
         case Variant::CALLABLE:
         {
             // There is no way to serialize a callable, only type is written.
-            p_file->store_32(VARIANT_CALLABLE);
+            p_writer.store_32(VARIANT_CALLABLE);
             break;
         }
         case Variant::SIGNAL:
         {
             // There is no way to serialize signals, only type is written.
-            p_file->store_32(VARIANT_SIGNAL);
+            p_writer.store_32(VARIANT_SIGNAL);
             break;
         }
         case Variant::DICTIONARY:
         {
-            p_file->store_32(VARIANT_DICTIONARY);
+            p_writer.store_32(VARIANT_DICTIONARY);
             Dictionary d = p_value;
-            p_file->store_32((uint32_t(d.size())));
+            p_writer.store_32((uint32_t(d.size())));
 
             Array keys = d.keys();
             for (int i = 0; i < keys.size(); i++)
             {
-                _write_variant(p_file, keys[i], p_resource_map, p_external_resources, p_string_map);
-                _write_variant(p_file, d[keys[i]], p_resource_map, p_external_resources, p_string_map);
+                _write_variant(p_writer, keys[i], p_resource_map, p_external_resources, p_string_map);
+                _write_variant(p_writer, d[keys[i]], p_resource_map, p_external_resources, p_string_map);
             }
             break;
         }
         case Variant::ARRAY:
         {
-            p_file->store_32(VARIANT_ARRAY);
             Array array = p_value;
-            p_file->store_32(array.size());
+            if (_is_dictionary_table(array, p_string_map))
+            {
+                _write_dictionary_table(p_writer, array, p_resource_map, p_external_resources, p_string_map);
+                break;
+            }
+
+            if (_is_integer_array(array))
+            {
+                _write_integer_array(p_writer, array);
+                break;
+            }
+
+            p_writer.store_32(VARIANT_ARRAY);
+            p_writer.store_32(array.size());
             for (int i = 0; i < array.size(); i++)
-                _write_variant(p_file, array[i], p_resource_map, p_external_resources, p_string_map);
+                _write_variant(p_writer, array[i], p_resource_map, p_external_resources, p_string_map);
             break;
         }
         case Variant::PACKED_BYTE_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_BYTE_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_BYTE_ARRAY);
             PackedByteArray array = p_value;
             const int size = static_cast<int>(array.size());
-            p_file->store_32(size);
+            p_writer.store_32(size);
             const uint8_t*data = array.ptr();
-            p_file->store_buffer(data, size);
-            _pad_buffer(p_file, size);
+            p_writer.store_buffer(data, size);
+            _pad_buffer(p_writer, size);
             break;
         }
         case Variant::PACKED_INT32_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_INT32_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_INT32_ARRAY);
             PackedInt32Array array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
-                p_file->store_32(array[i]);
+                p_writer.store_32(array[i]);
             break;
         }
         case Variant::PACKED_INT64_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_INT64_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_INT64_ARRAY);
             PackedInt64Array array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
-                p_file->store_64(array[i]);
+                p_writer.store_64(array[i]);
             break;
         }
         case Variant::PACKED_FLOAT32_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_FLOAT32_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_FLOAT32_ARRAY);
             PackedFloat32Array array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
-                p_file->store_float(array[i]);
+                p_writer.store_float(array[i]);
             break;
         }
         case Variant::PACKED_FLOAT64_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_FLOAT64_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_FLOAT64_ARRAY);
             PackedFloat64Array array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
-                p_file->store_double(array[i]);
+                p_writer.store_double(array[i]);
             break;
         }
         case Variant::PACKED_STRING_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_STRING_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_STRING_ARRAY);
             PackedStringArray array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
-                _save_unicode_string(p_file, array[i]);
+                _save_unicode_string(p_writer, array[i]);
             break;
         }
         case Variant::PACKED_VECTOR2_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_VECTOR2_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_VECTOR2_ARRAY);
             PackedVector2Array array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
             {
-                p_file->store_double(array[i].x);
-                p_file->store_double(array[i].y);
+                p_writer.store_double(array[i].x);
+                p_writer.store_double(array[i].y);
             }
             break;
         }
         case Variant::PACKED_VECTOR3_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_VECTOR3_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_VECTOR3_ARRAY);
             PackedVector3Array array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
             {
-                p_file->store_double(array[i].x);
-                p_file->store_double(array[i].y);
-                p_file->store_double(array[i].z);
+                p_writer.store_double(array[i].x);
+                p_writer.store_double(array[i].y);
+                p_writer.store_double(array[i].z);
             }
             break;
         }
         case Variant::PACKED_COLOR_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_COLOR_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_COLOR_ARRAY);
             PackedColorArray array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
             {
-                p_file->store_float(array[i].r);
-                p_file->store_float(array[i].g);
-                p_file->store_float(array[i].b);
-                p_file->store_float(array[i].a);
+                p_writer.store_float(array[i].r);
+                p_writer.store_float(array[i].g);
+                p_writer.store_float(array[i].b);
+                p_writer.store_float(array[i].a);
             }
             break;
         }
         case Variant::PACKED_VECTOR4_ARRAY:
         {
-            p_file->store_32(VARIANT_PACKED_VECTOR4_ARRAY);
+            p_writer.store_32(VARIANT_PACKED_VECTOR4_ARRAY);
             PackedVector4Array array = p_value;
             const int size = array.size();
-            p_file->store_32(size);
+            p_writer.store_32(size);
             for (int i = 0; i < size; i++)
             {
-                p_file->store_double(array[i].x);
-                p_file->store_double(array[i].y);
-                p_file->store_double(array[i].z);
-                p_file->store_double(array[i].w);
+                p_writer.store_double(array[i].x);
+                p_writer.store_double(array[i].y);
+                p_writer.store_double(array[i].z);
+                p_writer.store_double(array[i].w);
             }
             break;
         }
@@ -511,6 +539,149 @@ switch (p_value.get_type())
     }
 }
 
+bool OScriptBinaryResourceSaverInstance::_is_dictionary_table(const Array& p_array, const HashMap<StringName, int>& p_string_map)
+{
+    if (p_array.is_empty())
+        return false;
+
+    for (int i = 0; i < p_array.size(); i++)
+    {
+        const Variant& element = p_array[i];
+        if (element.get_type() != Variant::DICTIONARY)
+            return false;
+
+        const Array keys = Dictionary(element).keys();
+        for (int j = 0; j < keys.size(); j++)
+        {
+            const Variant& key = keys[j];
+            if (key.get_type() != Variant::STRING || !p_string_map.has(String(key)))
+                return false;
+        }
+    }
+    return true;
+}
+
+void OScriptBinaryResourceSaverInstance::_write_dictionary_table(OScriptBinaryWriter& p_writer, const Array& p_array,
+                                                                 HashMap<Ref<Resource>, int>& p_resource_map,
+                                                                 HashMap<Ref<Resource>, int>& p_external_resources,
+                                                                 HashMap<StringName, int>& p_string_map)
+{
+    const uint32_t row_count = p_array.size();
+
+    // Columns are the union of all dictionary keys, in order of first appearance
+    Vector<Dictionary> rows;
+    Vector<String> columns;
+    HashSet<String> column_set;
+    for (uint32_t i = 0; i < row_count; i++)
+    {
+        const Dictionary row = p_array[i];
+        rows.push_back(row);
+
+        const Array keys = row.keys();
+        for (int j = 0; j < keys.size(); j++)
+        {
+            const String key = keys[j];
+            if (!column_set.has(key))
+            {
+                column_set.insert(key);
+                columns.push_back(key);
+            }
+        }
+    }
+
+    p_writer.store_32(VARIANT_DICTIONARY_TABLE);
+    p_writer.store_32(row_count);
+    p_writer.store_32(columns.size());
+    for (const String& column : columns)
+        p_writer.store_32(p_string_map[column]);
+
+    // Each column is a bitmap of the rows that have the key, followed by the values for those rows
+    const uint32_t bitmap_size = (row_count + 7) / 8;
+
+    PackedByteArray bitmap;
+    bitmap.resize(bitmap_size);
+
+    for (const String& column : columns)
+    {
+        bitmap.fill(0);
+        for (uint32_t i = 0; i < row_count; i++)
+        {
+            if (rows[i].has(column))
+                bitmap[i >> 3] |= 1 << (i & 7);
+        }
+
+        p_writer.store_buffer(bitmap.ptr(), bitmap_size);
+        _pad_buffer(p_writer, bitmap_size);
+
+        for (uint32_t i = 0; i < row_count; i++)
+        {
+            if (rows[i].has(column))
+                _write_variant(p_writer, rows[i][column], p_resource_map, p_external_resources, p_string_map);
+        }
+    }
+}
+
+bool OScriptBinaryResourceSaverInstance::_is_integer_array(const Array& p_array)
+{
+    if (p_array.is_empty())
+        return false;
+
+    for (int i = 0; i < p_array.size(); i++)
+    {
+        if (p_array[i].get_type() != Variant::INT)
+            return false;
+    }
+    return true;
+}
+
+void OScriptBinaryResourceSaverInstance::_write_integer_array(OScriptBinaryWriter& p_writer, const Array& p_array)
+{
+    const uint32_t size = p_array.size();
+
+    bool wide = false;
+    for (uint32_t i = 0; i < size && !wide; i++)
+    {
+        const int64_t value = p_array[i];
+        wide = value > 0x7FFFFFFF || value < -(int64_t)0x80000000;
+    }
+
+    p_writer.store_32(VARIANT_INT_ARRAY);
+    p_writer.store_32(size);
+    p_writer.store_32(wide ? 8 : 4);
+
+    if (wide)
+    {
+        PackedInt64Array values;
+        values.resize(size);
+        for (uint32_t i = 0; i < size; i++)
+            values[i] = p_array[i];
+
+        // Written in bulk when the file matches the native little-endian layout
+        if (_big_endian)
+        {
+            for (uint32_t i = 0; i < size; i++)
+                p_writer.store_64(values[i]);
+        }
+        else
+            p_writer.store_buffer(reinterpret_cast<const uint8_t*>(values.ptr()), size * sizeof(int64_t));
+    }
+    else
+    {
+        PackedInt32Array values;
+        values.resize(size);
+        for (uint32_t i = 0; i < size; i++)
+            values[i] = static_cast<int32_t>(int64_t(p_array[i]));
+
+        if (_big_endian)
+        {
+            for (uint32_t i = 0; i < size; i++)
+                p_writer.store_32(values[i]);
+        }
+        else
+            p_writer.store_buffer(reinterpret_cast<const uint8_t*>(values.ptr()), size * sizeof(int32_t));
+    }
+}
+
 void OScriptBinaryResourceSaverInstance::_find_resources(const Variant& p_variant, bool p_main)
 {
     switch (p_variant.get_type())
@@ -602,6 +773,16 @@ void OScriptBinaryResourceSaverInstance::_find_resources(const Variant& p_varian
         }
         break;
 
+        case Variant::STRING:
+        case Variant::STRING_NAME:
+        {
+            // Short strings are written to the string table once and referenced by index
+            const String value = p_variant;
+            if (value.length() <= static_cast<int64_t>(MAX_INTERNED_STRING_LENGTH))
+                _get_string_index(value);
+        }
+        break;
+
         case Variant::NODE_PATH:
         {
             // Take the opportunity to save the node path strings
@@ -659,37 +840,37 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
 
     _find_resources(p_resource, true);
 
+    // The file is built in memory and written with a single call once complete
+    OScriptBinaryWriter writer;
+
     static const uint8_t header[4] = { 'G', 'D', 'O', 'S' };
-    file->store_buffer(header, 4);
+    writer.store_buffer(header, 4);
 
     if (_big_endian)
     {
-        file->store_32(1);
-        file->set_big_endian(true);
+        writer.store_32(1);
+        writer.set_big_endian(true);
     }
     else
     {
-        file->store_32(0);
+        writer.store_32(0);
     }
 
     // 64-bit files, false for now
-    file->store_32(0);
+    writer.store_32(0);
 
     // Store the format version of the file
-    file->store_32(FORMAT_VERSION);
+    writer.store_32(BINARY_FORMAT_VERSION);
 
     // Store the version of Godot the extension was built with.
-    file->store_32(GODOT_VERSION_MAJOR);
-    file->store_32(GODOT_VERSION_MINOR);
-    file->store_32(GODOT_VERSION_PATCH);
-
-    if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF)
-        return ERR_CANT_CREATE;
+    writer.store_32(GODOT_VERSION_MAJOR);
+    writer.store_32(GODOT_VERSION_MINOR);
+    writer.store_32(GODOT_VERSION_PATCH);
 
     // Store the resource class name
     // This means that if the class is renamed, this will yield the file unloadable.
     // Therefore, if classes are renamed, a version bump and migration step will be necessary to reload.
-    _save_unicode_string(file, p_resource->get_class());
+    _save_unicode_string(writer, p_resource->get_class());
 
     // Format 3 - script class, format flags, and uid
     String script_class;
@@ -702,18 +883,21 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
             if (!script_class.is_empty())
                 format_flags |= FORMAT_FLAG_HAS_SCRIPT_CLASS;
         }
-        file->store_32(format_flags);
+        writer.store_32(format_flags);
     }
 
     int64_t uid = _get_resource_id_for_path(p_path, true);
-    file->store_64(uid);
+    writer.store_64(uid);
     if (!script_class.is_empty())
-        _save_unicode_string(file, script_class);
+        _save_unicode_string(writer, script_class);
+
+    // The model version is stored in the first reserved field, separate from the container version
+    writer.store_32(FORMAT_VERSION);
 
     // We explicitly leave some buffer for extended resource bits later on.
     // These fields will allow extension points without compromising the format.
-    for (uint32_t i = 0; i < RESERVED_FIELDS; i++)
-        file->store_32(0);
+    for (uint32_t i = 1; i < RESERVED_FIELDS; i++)
+        writer.store_32(0);
 
     Dictionary missing_resource_properties = p_resource->get_meta("_missing_resources", Dictionary());
 
@@ -723,6 +907,9 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
         ResourceInfo& ri = resources.push_back(ResourceInfo())->get();
         ri.type = _resource_get_class(E);
 
+        // Format 4 - resource types are written by string table index
+        _get_string_index(ri.type);
+
         TypedArray<Dictionary> properties = E->get_property_list();
         for (int i = 0; i < properties.size(); i++)
         {
@@ -780,14 +967,22 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
         }
     }
 
+    // Reserve from the collected strings and properties, so that writing rarely reallocates
+    uint64_t estimated_size = 256;
+    for (const StringName& string : _strings)
+        estimated_size += 8 + String(string).length();
+    for (const ResourceInfo& ri : resources)
+        estimated_size += 64 + ri.properties.size() * 32;
+    writer.reserve(estimated_size);
+
     // Save string table
     // These are stored to minimize the file size rather than writing the string values multiple times
-    file->store_32(_strings.size());
+    writer.store_32(_strings.size());
     for (int i = 0; i < _strings.size(); i++)
-        _save_unicode_string(file, _strings[i]);
+        _save_unicode_string(writer, _strings[i]);
 
     // Store external resources
-    file->store_32(_external_resources.size());
+    writer.store_32(_external_resources.size());
     Vector<Ref<Resource>> save_order;
     save_order.resize(_external_resources.size());
     for (const KeyValue<Ref<Resource>, int>& E : _external_resources)
@@ -796,17 +991,17 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
     for (int i = 0; i < save_order.size(); i++)
     {
         // get_save_class() delegates to get_class()
-        _save_unicode_string(file, save_order[i]->get_class());
+        _save_unicode_string(writer, save_order[i]->get_class());
         String res_path = save_order[i]->get_path();
         res_path = _relative_paths ? StringUtils::path_to_file(_local_path, res_path) : res_path;
-        _save_unicode_string(file, res_path);
+        _save_unicode_string(writer, res_path);
 
         int64_t ruid = _get_resource_id_for_path(save_order[i]->get_path(), false);
-        file->store_64(ruid);
+        writer.store_64(ruid);
     }
 
     // Store internal resources
-    file->store_32(_saved_resources.size());
+    writer.store_32(_saved_resources.size());
 
     HashSet<String> used_unique_ids;
 
@@ -848,7 +1043,7 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
                 used_unique_ids.insert(new_id);
             }
 
-            _save_unicode_string(file, "local://" + itos(res_index));
+            _save_unicode_string(writer, "local://" + itos(res_index));
             if (_takeover_paths)
                 resource->set_path(vformat("%s::%s", p_path, resource->get_scene_unique_id()));
             #if GODOT_VERSION >= 0x040400
@@ -859,7 +1054,7 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
         }
         else
         {
-            _save_unicode_string(file, resource->get_path());
+            _save_unicode_string(writer, resource->get_path());
         }
         #else
         // All internal resources are written as "local://[index]"
@@ -867,42 +1062,42 @@ Error OScriptBinaryResourceSaverInstance::save(const String& p_path, const Ref<R
         //
         // When the file is loaded, the "local://" prefix is replaced with the resource path,
         // and "::" to handle uniquness within the Editor.
-        _save_unicode_string(file, "local://" + itos(res_index));
+        _save_unicode_string(writer, "local://" + itos(res_index));
         #endif
 
         // Save position reference and write placeholder, populating offset table later
-        offsets.push_back(file->get_position());
-        file->store_64(0);
+        offsets.push_back(writer.get_position());
+        writer.store_64(0);
         resource_map[resource] = res_index++;
     }
 
     Vector<uint64_t> offset_table;
     for (const ResourceInfo& ri : resources)
     {
-        offset_table.push_back(file->get_position());
-        _save_unicode_string(file, ri.type);
+        offset_table.push_back(writer.get_position());
+        writer.store_32(_string_map[ri.type]);
 
-        file->store_32(ri.properties.size());
+        writer.store_32(ri.properties.size());
         for (const Property& property : ri.properties)
         {
-            file->store_32(property.name_index);
-            _write_variant(file, property.value, resource_map, _external_resources, _string_map, property.info);
+            writer.store_32(property.name_index);
+            _write_variant(writer, property.value, resource_map, _external_resources, _string_map, property.info);
         }
     }
 
     // Now flush offset table
     for (int i = 0; i < offset_table.size(); i++)
     {
-        file->seek(offsets[i]);
-        file->store_64(offset_table[i]);
+        writer.seek(offsets[i]);
+        writer.store_64(offset_table[i]);
     }
 
-    file->seek_end();
+    writer.seek_end();
 
     // Store sentinel at the end of the file
-    file->store_buffer((const uint8_t*)"GDOS", 4);
+    writer.store_buffer((const uint8_t*)"GDOS", 4);
 
-    if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF)
+    if (writer.flush_to(file) != OK)
         return ERR_CANT_CREATE;
 
     return OK;
@@ -17,6 +17,7 @@
 #ifndef ORCHESTRATOR_SCRIPT_BINARY_SAVER_INSTANCE_H
 #define ORCHESTRATOR_SCRIPT_BINARY_SAVER_INSTANCE_H
 
+#include "script/serialization/binary_writer.h"
 #include "script/serialization/instance.h"
 
 #include <godot_cpp/classes/file_access.hpp>
@@ -78,21 +79,47 @@ class OScriptBinaryResourceSaverInstance : protected OScriptResourceBinaryFormat
     List<Ref<Resource>> _saved_resources;
 
     /// Pad the buffer with the given size
-    /// @param p_file the file to write
+    /// @param p_writer the buffer to write
     /// @param p_size the size to pad by
-    static void _pad_buffer(Ref<FileAccess> p_file, int p_size);
+    static void _pad_buffer(OScriptBinaryWriter& p_writer, int p_size);
 
-    /// Writes the variant value to the file
-    /// @param p_file the file reference
+    /// Writes the variant value to the buffer
+    /// @param p_writer the buffer to write
     /// @param p_value the value to be written
     /// @param p_resource_map the resource map
     /// @param p_external_resources the external resources
     /// @param p_string_map the string map
     /// @param p_hint the property information
-    void _write_variant(const Ref<FileAccess>& p_file, const Variant& p_value, HashMap<Ref<Resource>, int>& p_resource_map,
+    void _write_variant(OScriptBinaryWriter& p_writer, const Variant& p_value, HashMap<Ref<Resource>, int>& p_resource_map,
                         HashMap<Ref<Resource>, int>& p_external_resources, HashMap<StringName, int>& p_string_map,
                         const PropertyInfo& p_hint = PropertyInfo());
 
+    /// Checks whether the array can be written as a dictionary table, where every element is a
+    /// dictionary whose keys are strings held in the string table.
+    /// @param p_array the array
+    /// @param p_string_map the string map
+    /// @return true if the array can be written as a dictionary table, false otherwise
+    static bool _is_dictionary_table(const Array& p_array, const HashMap<StringName, int>& p_string_map);
+
+    /// Writes an array of dictionaries by column, so each key is written once rather than per dictionary
+    /// @param p_writer the buffer to write
+    /// @param p_array the array of dictionaries
+    /// @param p_resource_map the resource map
+    /// @param p_external_resources the external resources
+    /// @param p_string_map the string map
+    void _write_dictionary_table(OScriptBinaryWriter& p_writer, const Array& p_array, HashMap<Ref<Resource>, int>& p_resource_map,
+                                 HashMap<Ref<Resource>, int>& p_external_resources, HashMap<StringName, int>& p_string_map);
+
+    /// Checks whether the array only contains integers
+    /// @param p_array the array
+    /// @return true if the array is non-empty and only contains integers, false otherwise
+    static bool _is_integer_array(const Array& p_array);
+
+    /// Writes an array of integers packed, using 32-bit values when all values fit
+    /// @param p_writer the buffer to write
+    /// @param p_array the array of integers
+    void _write_integer_array(OScriptBinaryWriter& p_writer, const Array& p_array);
+
     /// Find resources within the provided variant
     /// @param p_variant the variant to inspect
     /// @param p_main whether the variant is the main resource
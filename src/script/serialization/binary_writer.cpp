@@ -0,0 +1,39 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/serialization/binary_writer.h"
+
+Error OScriptBinaryWriter::flush_to(const Ref<FileAccess>& p_file) const
+{
+    ERR_FAIL_COND_V(!p_file.is_valid(), ERR_INVALID_PARAMETER);
+
+    if (!_data.is_empty())
+        p_file->store_buffer(_data.ptr(), _data.size());
+
+    const Error err = p_file->get_error();
+    return err == OK || err == ERR_FILE_EOF ? OK : err;
+}
+
+PackedByteArray OScriptBinaryWriter::to_bytes() const
+{
+    PackedByteArray bytes;
+    if (!_data.is_empty())
+    {
+        bytes.resize(_data.size());
+        memcpy(bytes.ptrw(), _data.ptr(), _data.size());
+    }
+    return bytes;
+}
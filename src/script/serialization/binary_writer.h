@@ -0,0 +1,114 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_SERIALIZATION_BINARY_WRITER_H
+#define ORCHESTRATOR_SCRIPT_SERIALIZATION_BINARY_WRITER_H
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+using namespace godot;
+
+/// An in-memory growable byte buffer that mirrors the <code>FileAccess</code> store API.
+///
+/// Binary resources are built in memory and written with a single call, rather than crossing the
+/// GDExtension boundary for every field. The byte layout matches what <code>FileAccess</code> would
+/// write for the same sequence of calls, including the endianness swap.
+class OScriptBinaryWriter
+{
+    LocalVector<uint8_t> _data;
+    uint64_t _position{ 0 };
+    bool _big_endian{ false };
+
+    /// Makes sure the buffer can hold the specified number of bytes at the current position
+    /// @param p_size the number of bytes about to be written
+    _FORCE_INLINE_ void _ensure_size(uint64_t p_size)
+    {
+        // LocalVector grows its capacity geometrically, so appending is amortized
+        const uint64_t end = _position + p_size;
+        if (end > _data.size())
+            _data.resize(end);
+    }
+
+    /// Writes raw bytes at the current position
+    /// @param p_data the bytes
+    /// @param p_size the number of bytes
+    _FORCE_INLINE_ void _write(const uint8_t* p_data, uint64_t p_size)
+    {
+        _ensure_size(p_size);
+        memcpy(_data.ptr() + _position, p_data, p_size);
+        _position += p_size;
+    }
+
+    /// Writes a value in the buffer's byte order
+    /// @param p_value the value
+    template <typename T>
+    _FORCE_INLINE_ void _write_value(T p_value)
+    {
+        uint8_t bytes[sizeof(T)];
+        memcpy(bytes, &p_value, sizeof(T));
+        if (_big_endian)
+        {
+            for (uint32_t i = 0; i < sizeof(T) / 2; i++)
+                SWAP(bytes[i], bytes[sizeof(T) - 1 - i]);
+        }
+        _write(bytes, sizeof(T));
+    }
+
+public:
+    /// Sets whether values are written big-endian
+    /// @param p_big_endian true to write big-endian, false for little-endian
+    void set_big_endian(bool p_big_endian) { _big_endian = p_big_endian; }
+
+    /// Reserves capacity, so that writing up to the specified size does not reallocate
+    /// @param p_size the expected size in bytes
+    void reserve(uint64_t p_size) { _data.reserve(p_size); }
+
+    void store_8(uint8_t p_value) { _write(&p_value, 1); }
+    void store_16(uint16_t p_value) { _write_value(p_value); }
+    void store_32(uint32_t p_value) { _write_value(p_value); }
+    void store_64(uint64_t p_value) { _write_value(p_value); }
+    void store_float(float p_value) { _write_value(p_value); }
+    void store_double(double p_value) { _write_value(p_value); }
+    void store_real(real_t p_value) { _write_value(p_value); }
+    void store_buffer(const uint8_t* p_data, uint64_t p_size) { _write(p_data, p_size); }
+
+    /// Get the current write position
+    /// @return the position in bytes
+    uint64_t get_position() const { return _position; }
+
+    /// Get the number of bytes written
+    /// @return the buffer length
+    uint64_t get_length() const { return _data.size(); }
+
+    /// Moves the write position, used to patch previously written placeholders
+    /// @param p_position the position
+    void seek(uint64_t p_position) { _position = p_position; }
+
+    /// Moves the write position to the end of the buffer
+    void seek_end() { _position = _data.size(); }
+
+    /// Copies the buffer contents into a byte array
+    /// @return the buffer contents
+    PackedByteArray to_bytes() const;
+
+    /// Writes the buffer contents to the file with a single call
+    /// @param p_file the file
+    /// @return the error code, <code>OK</code> if successful
+    Error flush_to(const Ref<FileAccess>& p_file) const;
+};
+
+#endif // ORCHESTRATOR_SCRIPT_SERIALIZATION_BINARY_WRITER_H
@@ -51,6 +51,14 @@ bool OScriptResourceFormatInstance::_is_resource_built_in(const Ref<Resource>& p
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// The binary file format version, which may advance independently of the text format
+// 3: Matches the shared format version
+// 4: Interned strings, resource types by string index, columnar dictionary tables, packed integer arrays
+uint32_t OScriptResourceBinaryFormatInstance::BINARY_FORMAT_VERSION = 4;
+
+// Strings up to this length are interned into the binary string table and written by index
+uint32_t OScriptResourceBinaryFormatInstance::MAX_INTERNED_STRING_LENGTH = 256;
+
 String OScriptResourceBinaryFormatInstance::_read_unicode_string(const Ref<FileAccess>& p_file)
 {
     int length = p_file->get_32();
@@ -76,6 +84,20 @@ void OScriptResourceBinaryFormatInstance::_save_unicode_string(const Ref<FileAcc
     p_file->store_buffer((const uint8_t*)utf8.get_data(), utf8.length() + 1);
 }
 
+void OScriptResourceBinaryFormatInstance::_save_unicode_string(OScriptBinaryWriter& p_writer, const String& p_value, bool p_bit_on_length)
+{
+    CharString utf8 = p_value.utf8();
+
+    size_t length;
+    if (p_bit_on_length)
+        length = (utf8.length() + 1) | 0x8000000;
+    else
+        length = (utf8.length() + 1);
+
+    p_writer.store_32(length);
+    p_writer.store_buffer((const uint8_t*)utf8.get_data(), utf8.length() + 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 String OScriptResourceTextFormatInstance::_create_start_tag(const String& p_resource_class, const String& p_script_class, uint32_t p_load_steps, uint32_t p_version, int64_t p_uid)
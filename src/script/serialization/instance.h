@@ -18,6 +18,7 @@
 #define ORCHESTRATOR_SCRIPT_SERIALIZATION_INSTANCE_H
 
 #include "godot_cpp/classes/ref.hpp"
+#include "script/serialization/binary_writer.h"
 
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/resource.hpp>
@@ -89,6 +90,10 @@ public:
         VARIANT_VECTOR4I = 51,
         VARIANT_PROJECTION = 52,
         VARIANT_PACKED_VECTOR4_ARRAY = 53,
+        VARIANT_STRING_INDEX = 54,          // Binary format 4, String stored in the string table
+        VARIANT_STRING_NAME_INDEX = 55,     // Binary format 4, StringName stored in the string table
+        VARIANT_DICTIONARY_TABLE = 56,      // Binary format 4, Array of string-keyed Dictionaries stored by column
+        VARIANT_INT_ARRAY = 57,             // Binary format 4, Array of integers stored packed
 
         // Other static values
         OBJECT_EMPTY = 0,
@@ -112,6 +117,9 @@ protected:
         FORMAT_FLAG_HAS_SCRIPT_CLASS = 8,
     };
 
+    static uint32_t BINARY_FORMAT_VERSION;
+    static uint32_t MAX_INTERNED_STRING_LENGTH;
+
     /// Reads a unicode string from the given file
     /// @param p_file the file reference
     /// @return the unicode string
@@ -122,6 +130,12 @@ protected:
     /// @param p_value the string to be stored
     /// @param p_bit_on_length ??
     void _save_unicode_string(const Ref<FileAccess>& p_file, const String& p_value, bool p_bit_on_length = false);
+
+    /// Save the specified string in the given buffer in unicode format.
+    /// @param p_writer the buffer
+    /// @param p_value the string to be stored
+    /// @param p_bit_on_length ??
+    void _save_unicode_string(OScriptBinaryWriter& p_writer, const String& p_value, bool p_bit_on_length = false);
 };
 
 /// A common class for text-based resource format instances
@@ -174,7 +174,7 @@ Variant OScriptBinaryResourceLoader::_load(const String& p_path, const String& p
     if (script.is_valid())
     {
         script->set_path(local_path);
-        script->_version = loader._version;
+        script->_version = loader._model_version;
 
         // Sanity check, used to be in OrchestratorScriptView, but belongs here instead
         if (script->get_orchestration()->get_type() == OT_Script && !script->has_graph("EventGraph"))
@@ -16,8 +16,11 @@
 //
 #include "script/serialization/text_loader_instance.h"
 
+#include "common/callable_lambda.h"
+#include "common/settings.h"
 #include "common/string_utils.h"
 #include "editor/plugins/orchestrator_editor_plugin.h"
+#include "script/language.h"
 #include "script/script.h"
 #include "script/serialization/resource_cache.h"
 
@@ -26,6 +29,7 @@
 #include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
 #include <godot_cpp/classes/scene_state.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/core/version.hpp>
 
 #define _printerr() ERR_PRINT(String(_res_path + ":" + itos(_lines) + " - Parse Error: " + _error_text).utf8().get_data());
@@ -214,6 +218,428 @@ Error OScriptTextResourceLoaderInstance::_parse_ext_resource(OScriptVariantParse
     return err;
 }
 
+Error OScriptTextResourceLoaderInstance::_create_sub_resource(const String& p_type, const String& p_id, Ref<Resource>& r_res,
+                                                             bool& r_do_assign, MissingResource*& r_missing_resource)
+{
+    String path = _local_path + "::" + p_id;
+
+    Ref<Resource> res;
+    bool do_assign{ false };
+    if (_cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path))
+    {
+        // Reuse existing
+        Ref<Resource> cache = ResourceCache::get_singleton()->get_ref(path);
+        if (cache.is_valid() && cache->get_class() == p_type)
+        {
+            res = cache;
+            #if GODOT_VERSION >= 0x040400
+            res->reset_state();
+            #endif
+            do_assign = true;
+        }
+    }
+
+    MissingResource* missing_resource = nullptr;
+
+    if (res.is_null())
+    {
+        Ref<Resource> cache = ResourceCache::get_singleton()->get_ref(path);
+        if (_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE && cache.is_valid())
+        {
+            // cached, do not assign
+            res = cache;
+        }
+        else
+        {
+            // Create
+            Variant obj = ClassDB::instantiate(p_type);
+            if (!obj)
+            {
+                if (_is_creating_missing_resources_if_class_unavailable_enabled())
+                {
+                    missing_resource = memnew(MissingResource);
+                    missing_resource->set_original_class(p_type);
+                    missing_resource->set_recording_properties(true);
+                    obj = missing_resource;
+                }
+                else
+                {
+                    _error_text = "Cannot create sub resource of type: " + p_type;
+                    _printerr();
+                    _error = ERR_FILE_CORRUPT;
+                    return _error;
+                }
+            }
+
+            Resource* r = Object::cast_to<Resource>(obj);
+            if (!r)
+            {
+                _error_text = "Cannot create sub resource of type, because not a resource: " + p_type;
+                _printerr();
+                _error = ERR_FILE_CORRUPT;
+                return _error;
+            }
+
+            res = Ref<Resource>(r);
+            do_assign = true;
+        }
+    }
+
+    _resource_current++;
+
+    if (_progress && _resources_total > 0)
+        *_progress = _resource_current / float(_resources_total);
+
+    _internal_resources[p_id] = res;
+    if (do_assign)
+    {
+        if (_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE)
+        {
+            if (_cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE)
+                res->take_over_path(path);
+            else
+                res->set_path(path);
+        }
+        else
+        {
+            #if GODOT_VERSION >= 0x040400
+            res->set_path_cache(path);
+            #endif
+        }
+
+        #if GODOT_VERSION >= 0x040300
+        res->set_scene_unique_id(p_id);
+        #else
+        ResourceCache::get_singleton()->set_scene_unique_id(_local_path, res, p_id);
+        #endif
+    }
+
+    r_res = res;
+    r_do_assign = do_assign;
+    r_missing_resource = missing_resource;
+
+    return OK;
+}
+
+void OScriptTextResourceLoaderInstance::_set_sub_resource_property(const Ref<Resource>& p_res, MissingResource* p_missing_resource,
+                                                                   const String& p_assign, const Variant& p_value,
+                                                                   Dictionary& r_missing_properties)
+{
+    Variant value = p_value;
+
+    bool set_valid{ true };
+    if (value.get_type() == Variant::OBJECT && p_missing_resource != nullptr)
+    {
+        // If the property being set is a missing resource and the parent isn't, setting it
+        // most likely will not work, so save it as metadata
+        Ref<MissingResource> mr = value;
+        if (mr.is_valid())
+        {
+            r_missing_properties[p_assign] = mr;
+            set_valid = false;
+        }
+    }
+    if (value.get_type() == Variant::ARRAY)
+    {
+        Array set_array = value;
+        // todo: how to deal with is valid?
+        Variant get_value = p_res->get(p_assign);
+        if (get_value.get_type() == Variant::ARRAY)
+        {
+            Array get_array = get_value;
+            if (!set_array.is_same_typed(get_array))
+                value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+        }
+    }
+
+    if (set_valid)
+        p_res->set(p_assign, value);
+}
+
+bool OScriptTextResourceLoaderInstance::_is_parallel_load_enabled() const
+{
+    if (_ignore_resource_parsing)
+        return false;
+
+    OrchestratorSettings* settings = OrchestratorSettings::get_singleton();
+    if (!settings)
+        return false;
+
+    const int threshold = settings->get_setting("settings/parallel_load_threshold", 256);
+    return threshold > 0 && _resources_total >= threshold;
+}
+
+Error OScriptTextResourceLoaderInstance::_parse_sub_resources_parallel(void* p_self, OScriptVariantParser::Stream* p_stream, Ref<Resource>& r_res, int& r_line, String& r_err_string)
+{
+    const ParallelSection* section = reinterpret_cast<ParallelSection*>(p_self);
+    const OScriptTextResourceLoaderInstance* loader = section->loader;
+
+    OScriptVariantParser::Token token;
+    OScriptVariantParser::get_token(p_stream, r_line, token, r_err_string);
+    if (token.type != OScriptVariantParser::TK_NUMBER && token.type != OScriptVariantParser::TK_STRING)
+    {
+        r_err_string = "Expected number (old style) or string (sub-resource index)";
+        return ERR_PARSE_ERROR;
+    }
+
+    // All sections are created upfront, but like sequential loads only earlier sections may be referenced
+    String id = token.value;
+    const HashMap<String, int>::ConstIterator E = loader->_section_indices.find(id);
+    ERR_FAIL_COND_V(!E || E->value >= section->index, ERR_INVALID_PARAMETER);
+    r_res = loader->_internal_resources[id];
+
+    OScriptVariantParser::get_token(p_stream, r_line, token, r_err_string);
+    if (token.type != OScriptVariantParser::TK_PARENTHESIS_CLOSE)
+    {
+        r_err_string = "Expected ')'";
+        return ERR_PARSE_ERROR;
+    }
+
+    return OK;
+}
+
+Error OScriptTextResourceLoaderInstance::_parse_ext_resources_parallel(void* p_self, OScriptVariantParser::Stream* p_stream, Ref<Resource>& r_res, int& r_line, String& r_err_string)
+{
+    return reinterpret_cast<ParallelSection*>(p_self)->loader->_parse_ext_resource(p_stream, r_res, r_line, r_err_string);
+}
+
+void OScriptTextResourceLoaderInstance::_parse_section(ParallelSection& r_section) const
+{
+    OScriptVariantParser::StreamString stream;
+    stream._data = _section_text.substr(r_section.body_begin, r_section.body_end - r_section.body_begin);
+
+    OScriptVariantParser::ResourceParser parser;
+    parser.external_func = _parse_ext_resources_parallel;
+    parser.subres_func = _parse_sub_resources_parallel;
+    parser.userdata = &r_section;
+
+    OScriptVariantParser::Tag tag;
+    while (true)
+    {
+        String assign;
+        Variant value;
+
+        const Error err = OScriptVariantParser::parse_tag_assign_eof(&stream, r_section.line, r_section.error_text, tag, assign, value, &parser);
+        if (err == ERR_FILE_EOF)
+            break;
+
+        if (err)
+        {
+            r_section.error = err;
+            return;
+        }
+
+        if (assign.is_empty())
+            break;
+
+        r_section.names.push_back(assign);
+        r_section.values.push_back(value);
+    }
+}
+
+Error OScriptTextResourceLoaderInstance::_load_sub_resources_parallel()
+{
+    // The remaining file is read in one pass, the current tag is the first sub-resource.
+    PackedByteArray bytes = _stream.read_remaining();
+
+    _section_text = String::utf8(reinterpret_cast<const char*>(bytes.ptr()), bytes.size());
+    bytes.clear();
+
+    // Split the text into sections, where each section begins with a tag at the start of a line.
+    // Tags within strings or comments are skipped, so multi-line string values do not split sections.
+    struct SectionRange
+    {
+        int64_t begin{ 0 };       // Start of the tag, or the text for the current tag
+        int64_t body_begin{ 0 };  // Start of the body after the tag
+        int line{ 0 };            // Line of the tag
+        int body_line{ 0 };       // Line of the body
+    };
+
+    Vector<SectionRange> ranges;
+    {
+        SectionRange first;
+        first.line = _lines;
+        first.body_line = _lines;
+        ranges.push_back(first);
+    }
+
+    const int64_t length = _section_text.length();
+    const char32_t* text = _section_text.ptr();
+
+    int line = _lines;
+    int depth = 0;
+    bool in_string = false;
+    bool in_tag = false;
+    bool line_start = false;
+    for (int64_t i = 0; i < length; i++)
+    {
+        const char32_t c = text[i];
+        if (in_string)
+        {
+            if (c == '\\')
+                i++;
+            else if (c == '"')
+                in_string = false;
+            else if (c == '\n')
+                line++;
+            continue;
+        }
+
+        if (c == '\n')
+        {
+            line++;
+            line_start = true;
+            continue;
+        }
+
+        if (c == '"')
+            in_string = true;
+        else if (c == ';')
+        {
+            while (i + 1 < length && text[i + 1] != '\n')
+                i++;
+        }
+        else if (c == '[' && line_start && depth == 0 && !in_tag)
+        {
+            SectionRange range;
+            range.begin = i;
+            range.body_begin = length;
+            range.line = line;
+            ranges.push_back(range);
+            in_tag = true;
+        }
+        else if (c == ']' && in_tag)
+        {
+            ranges.write[ranges.size() - 1].body_begin = i + 1;
+            ranges.write[ranges.size() - 1].body_line = line;
+            in_tag = false;
+        }
+        else if (!in_tag && (c == '[' || c == '{' || c == '('))
+            depth++;
+        else if (!in_tag && depth > 0 && (c == ']' || c == '}' || c == ')'))
+            depth--;
+
+        if (c != ' ' && c != '\t' && c != '\r')
+            line_start = false;
+    }
+
+    // Create every sub-resource in file order on this thread, so sections may be parsed independently
+    Vector<ParallelSection> sections;
+    int tail_index = -1;
+    for (int i = 0; i < ranges.size(); i++)
+    {
+        const SectionRange& range = ranges[i];
+
+        OScriptVariantParser::Tag tag;
+        if (i == 0)
+            tag = _next_tag;
+        else
+        {
+            OScriptVariantParser::StreamString header;
+            header._data = _section_text.substr(range.begin, range.body_begin - range.begin);
+
+            _lines = range.line;
+            _error = OScriptVariantParser::parse_tag(&header, _lines, tag, _error_text);
+            if (_error)
+            {
+                _printerr();
+                return _error;
+            }
+        }
+
+        if (tag.name != "obj")
+        {
+            tail_index = i;
+            break;
+        }
+
+        _lines = range.line;
+        if (!tag.fields.has("type"))
+        {
+            _error = ERR_FILE_CORRUPT;
+            _error_text = "Missing 'type' in subresource tag";
+            _printerr();
+            return _error;
+        }
+        if (!tag.fields.has("id"))
+        {
+            _error = ERR_FILE_CORRUPT;
+            _error_text = "Missing 'id' in subresource tag";
+            _printerr();
+            return _error;
+        }
+
+        ParallelSection section;
+        section.loader = this;
+        section.index = i;
+        section.line = range.body_line;
+        section.id = tag.fields["id"];
+        section.body_begin = range.body_begin;
+        section.body_end = i + 1 < ranges.size() ? ranges[i + 1].begin : length;
+
+        if (const Error err = _create_sub_resource(tag.fields["type"], section.id, section.resource, section.do_assign, section.missing_resource))
+            return err;
+
+        _section_indices[section.id] = i;
+        sections.push_back(section);
+    }
+
+    // Parse the section properties on worker threads
+    ParallelSection* sections_ptr = sections.ptrw();
+    const Callable task = callable_mp_lambda(OScriptLanguage::get_singleton(), [this, sections_ptr](uint32_t p_index) {
+        _parse_section(sections_ptr[p_index]);
+    });
+
+    WorkerThreadPool* pool = WorkerThreadPool::get_singleton();
+    const int64_t group_id = pool->add_group_task(task, sections.size(), -1, false, "Orchestration sub-resource parsing");
+    pool->wait_for_group_task_completion(group_id);
+
+    // Assign the properties in file order, so resources observe the same sequence as a sequential load
+    for (const ParallelSection& section : sections)
+    {
+        if (section.error)
+        {
+            _error = section.error;
+            _error_text = section.error_text;
+            _lines = section.line;
+            _printerr();
+            return _error;
+        }
+
+        Dictionary missing_properties;
+        if (section.do_assign)
+        {
+            for (int i = 0; i < section.names.size(); i++)
+                _set_sub_resource_property(section.resource, section.missing_resource, section.names[i], section.values[i], missing_properties);
+        }
+
+        if (section.missing_resource)
+            section.missing_resource->set_recording_properties(false);
+
+        if (!missing_properties.is_empty())
+            section.resource->set_meta("metadata/_missing_resources", missing_properties);
+    }
+
+    // Continue with the remaining tags, such as the main resource, from the already read text
+    _tail_stream._data = tail_index != -1 ? _section_text.substr(ranges[tail_index].begin) : String();
+    _section_text = String();
+    _body_stream = &_tail_stream;
+
+    if (tail_index != -1)
+        _lines = ranges[tail_index].line;
+
+    _error = OScriptVariantParser::parse_tag(_body_stream, _lines, _next_tag, _error_text);
+    if (_error)
+    {
+        _error_text = "Unexpected end of file";
+        _printerr();
+        _error = ERR_FILE_CORRUPT;
+        return _error;
+    }
+
+    return OK;
+}
+
 PackedStringArray OScriptTextResourceLoaderInstance::get_dependencies(const Ref<FileAccess>& p_file, bool p_add_types)
 {
     PackedStringArray deps;
@@ -523,6 +949,8 @@ void OScriptTextResourceLoaderInstance::open(const Ref<FileAccess>& p_file, bool
     _rp.external_func = _parse_ext_resources;
     _rp.subres_func = _parse_sub_resources;
     _rp.userdata = this;
+
+    _body_stream = &_stream;
 }
 
 Error OScriptTextResourceLoaderInstance::load()
@@ -620,6 +1048,12 @@ Error OScriptTextResourceLoaderInstance::load()
     _resources_total -= _resource_current;
     _resource_current = 0;
 
+    if (_next_tag.name == "obj" && _is_parallel_load_enabled())
+    {
+        if (const Error err = _load_sub_resources_parallel())
+            return err;
+    }
+
     while (true)
     {
         if (_next_tag.name != "obj")
@@ -643,98 +1077,11 @@ Error OScriptTextResourceLoaderInstance::load()
         String type = _next_tag.fields["type"];
         String id = _next_tag.fields["id"];
 
-        String path = _local_path + "::" + id;
-
         Ref<Resource> res;
         bool do_assign{ false };
-        if (_cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path))
-        {
-            // Reuse existing
-            Ref<Resource> cache = ResourceCache::get_singleton()->get_ref(path);
-            if (cache.is_valid() && cache->get_class() == type)
-            {
-                res = cache;
-                #if GODOT_VERSION >= 0x040400
-                res->reset_state();
-                #endif
-                do_assign = true;
-            }
-        }
-
         MissingResource* missing_resource = nullptr;
-
-        if (res.is_null())
-        {
-            Ref<Resource> cache = ResourceCache::get_singleton()->get_ref(path);
-            if (_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE && cache.is_valid())
-            {
-                // cached, do not assign
-                res = cache;
-            }
-            else
-            {
-                // Create
-                Variant obj = ClassDB::instantiate(type);
-                if (!obj)
-                {
-                    if (_is_creating_missing_resources_if_class_unavailable_enabled())
-                    {
-                        missing_resource = memnew(MissingResource);
-                        missing_resource->set_original_class(type);
-                        missing_resource->set_recording_properties(true);
-                        obj = missing_resource;
-                    }
-                    else
-                    {
-                        _error_text = "Cannot create sub resource of type: " + type;
-                        _printerr();
-                        _error = ERR_FILE_CORRUPT;
-                        return _error;
-                    }
-                }
-
-                Resource* r = Object::cast_to<Resource>(obj);
-                if (!r)
-                {
-                    _error_text = "Cannot create sub resource of type, because not a resource: " + type;
-                    _printerr();
-                    _error = ERR_FILE_CORRUPT;
-                    return _error;
-                }
-
-                res = Ref<Resource>(r);
-                do_assign = true;
-            }
-        }
-
-        _resource_current++;
-
-        if (_progress && _resources_total > 0)
-            *_progress = _resource_current / float(_resources_total);
-
-        _internal_resources[id] = res;
-        if (do_assign)
-        {
-            if (_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE)
-            {
-                if (_cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE)
-                    res->take_over_path(path);
-                else
-                    res->set_path(path);
-            }
-            else
-            {
-                #if GODOT_VERSION >= 0x040400
-                res->set_path_cache(path);
-                #endif
-            }
-
-            #if GODOT_VERSION >= 0x040300
-            res->set_scene_unique_id(id);
-            #else
-            ResourceCache::get_singleton()->set_scene_unique_id(_local_path, res, id);
-            #endif
-        }
+        if (const Error err = _create_sub_resource(type, id, res, do_assign, missing_resource))
+            return err;
 
         Dictionary missing_properties;
         while (true)
@@ -752,35 +1099,7 @@ Error OScriptTextResourceLoaderInstance::load()
             if (!assign.is_empty())
             {
                 if (do_assign)
-                {
-                    bool set_valid{ true };
-                    if (value.get_type() == Variant::OBJECT && missing_resource != nullptr)
-                    {
-                        // If the property being set is a missing resource and the parent isn't, setting it
-                        // most likely will not work, so save it as metadata
-                        Ref<MissingResource> mr = value;
-                        if (mr.is_valid())
-                        {
-                            missing_properties[assign] = mr;
-                            set_valid = false;
-                        }
-                    }
-                    if (value.get_type() == Variant::ARRAY)
-                    {
-                        Array set_array = value;
-                        // todo: how to deal with is valid?
-                        Variant get_value = res->get(assign);
-                        if (get_value.get_type() == Variant::ARRAY)
-                        {
-                            Array get_array = get_value;
-                            if (!set_array.is_same_typed(get_array))
-                                value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-                        }
-                    }
-
-                    if (set_valid)
-                        res->set(assign, value);
-                }
+                    _set_sub_resource_property(res, missing_resource, assign, value, missing_properties);
             }
             else if (!_next_tag.name.is_empty())
             {
@@ -867,7 +1186,7 @@ Error OScriptTextResourceLoaderInstance::load()
 			String assign;
 			Variant value;
 
-			_error = OScriptVariantParser::parse_tag_assign_eof(&_stream, _lines, _error_text, _next_tag, assign, value, &_rp);
+			_error = OScriptVariantParser::parse_tag_assign_eof(_body_stream, _lines, _error_text, _next_tag, assign, value, &_rp);
 			if (_error)
 			{
 				if (_error != ERR_FILE_EOF)
@@ -21,6 +21,7 @@
 #include "script/serialization/variant_parser.h"
 
 #include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/missing_resource.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
 #include <godot_cpp/classes/resource_format_loader.hpp>
 #include <godot_cpp/classes/resource_uid.hpp>
@@ -47,7 +48,27 @@ class OScriptTextResourceLoaderInstance : public OScriptResourceTextFormatInstan
         Ref<Resource> resource;
     };
 
+    /// A sub-resource section that is parsed on a worker thread
+    struct ParallelSection
+    {
+        OScriptTextResourceLoaderInstance* loader{ nullptr };
+        int index{ 0 };                                //! Section order within the file
+        int line{ 0 };                                 //! Line the body starts, or the error line
+        int64_t body_begin{ 0 };                       //! Start of the body in the section text
+        int64_t body_end{ 0 };                         //! End of the body in the section text
+        String id;
+        Ref<Resource> resource;
+        MissingResource* missing_resource{ nullptr };
+        bool do_assign{ false };
+        PackedStringArray names;                       //! Parsed property names, in file order
+        Vector<Variant> values;                        //! Parsed property values, in file order
+        Error error{ OK };
+        String error_text;
+    };
+
     OScriptVariantParser::StreamFile _stream;
+    OScriptVariantParser::StreamString _tail_stream;
+    OScriptVariantParser::Stream* _body_stream{ nullptr };
     OScriptVariantParser::ResourceParser _rp;
     OScriptVariantParser::Tag _next_tag;
 
@@ -55,6 +76,8 @@ class OScriptTextResourceLoaderInstance : public OScriptResourceTextFormatInstan
     HashMap<String, ExtResource> _external_resources;
     HashMap<String, Ref<Resource>> _internal_resources;
     HashMap<String, String> _remaps;
+    HashMap<String, int> _section_indices;
+    String _section_text;
 
     bool _translation_remapped{ false };
     bool _is_scene{ false };
@@ -113,6 +136,41 @@ class OScriptTextResourceLoaderInstance : public OScriptResourceTextFormatInstan
     Error _parse_sub_resource(OScriptVariantParser::Stream* p_stream, Ref<Resource>& r_res, int& r_line, String& r_err_string);
     Error _parse_ext_resource(OScriptVariantParser::Stream* p_stream, Ref<Resource>& r_res, int& r_line, String& r_err_string);
 
+    static Error _parse_sub_resources_parallel(void* p_self, OScriptVariantParser::Stream* p_stream, Ref<Resource>& r_res, int& r_line, String& r_err_string);
+    static Error _parse_ext_resources_parallel(void* p_self, OScriptVariantParser::Stream* p_stream, Ref<Resource>& r_res, int& r_line, String& r_err_string);
+
+    /// Creates or reuses the sub-resource for an <code>obj</code> tag
+    /// @param p_type the resource type
+    /// @param p_id the sub-resource id
+    /// @param r_res the sub-resource
+    /// @param r_do_assign whether properties should be assigned to the sub-resource
+    /// @param r_missing_resource the missing resource placeholder, if the type is unavailable
+    /// @return the error code, <code>OK</code> if successful
+    Error _create_sub_resource(const String& p_type, const String& p_id, Ref<Resource>& r_res, bool& r_do_assign,
+                               MissingResource*& r_missing_resource);
+
+    /// Assigns a parsed property to a sub-resource
+    /// @param p_res the sub-resource
+    /// @param p_missing_resource the missing resource placeholder, may be <code>nullptr</code>
+    /// @param p_assign the property name
+    /// @param p_value the property value
+    /// @param r_missing_properties properties that could not be set on a missing resource
+    void _set_sub_resource_property(const Ref<Resource>& p_res, MissingResource* p_missing_resource, const String& p_assign,
+                                    const Variant& p_value, Dictionary& r_missing_properties);
+
+    /// Return whether sub-resources should be parsed on worker threads
+    /// @return <code>true</code> if the file has enough sub-resources to parse in parallel
+    bool _is_parallel_load_enabled() const;
+
+    /// Parses the properties of a single sub-resource section, called from worker threads
+    /// @param r_section the section
+    void _parse_section(ParallelSection& r_section) const;
+
+    /// Loads all remaining sub-resources, parsing each section's properties on worker threads. Resources are
+    /// created and properties are assigned in file order on the calling thread.
+    /// @return the error code, <code>OK</code> if successful
+    Error _load_sub_resources_parallel();
+
 public:
     /// Gets all dependencies
     /// @param p_file the opened file stream
@@ -277,6 +277,9 @@ Error OScriptTextResourceSaverInstance::save(const String& p_path, const Ref<Res
     // Save resources
     _find_resources(p_resource, true);
 
+    // The text is built as UTF-8 in memory and written with a single call once complete
+    OScriptTextWriter writer;
+
     {
         String title = "[orchestration type=\"" + _resource_get_class(p_resource) + "\" ";
         #if GODOT_VERSION >= 0x040300
@@ -295,8 +298,8 @@ Error OScriptTextResourceSaverInstance::save(const String& p_path, const Ref<Res
         if (uid != ResourceUID::INVALID_ID)
             title += " uid=\"" + ResourceUID::get_singleton()->id_to_text(uid) + "\"";
 
-        file->store_string(title);
-        file->store_line("]\n"); // One empty line.
+        writer.append(title);
+        writer.append("]\n\n"); // One empty line.
     }
 
     #ifdef TOOLS_ENABLED
@@ -373,11 +376,11 @@ Error OScriptTextResourceSaverInstance::save(const String& p_path, const Ref<Res
         String res_id = sorted_external_resources[i].id;
 
         String s = _create_ext_resource_tag(res_class, res_path, res_id);
-        file->store_string(s); // Bundled
+        writer.append(s); // Bundled
     }
 
     if (_external_resources.size())
-        file->store_line(String()); // Separate.
+        writer.append_char('\n'); // Separate.
 
     HashSet<String> used_unique_ids;
     for (List<Ref<Resource>>::Element* E = _saved_resources.front(); E; E = E->next())
@@ -415,7 +418,7 @@ Error OScriptTextResourceSaverInstance::save(const String& p_path, const Ref<Res
 
         if (main)
         {
-            file->store_line("[resource]");
+            writer.append("[resource]\n");
         }
         else
         {
@@ -456,7 +459,8 @@ Error OScriptTextResourceSaverInstance::save(const String& p_path, const Ref<Res
             #endif
 
             line += "type=\"" + _resource_get_class(res) + "\" id=\"" + id;
-            file->store_line(line + "\"]");
+            writer.append(line);
+            writer.append("\"]\n");
             if (_take_over_paths)
                 res->set_path(vformat("%s::%s", p_path, id));
 
@@ -518,17 +522,18 @@ Error OScriptTextResourceSaverInstance::save(const String& p_path, const Ref<Res
                         continue;
                 }
 
-                String vars;
-                OScriptVariantWriter::write_to_string(value, vars, _write_resources, this);
-                file->store_string(StringUtils::property_name_encode(name) + " = " + vars + "\n");
+                writer.append(StringUtils::property_name_encode(name));
+                writer.append(" = ", 3);
+                OScriptVariantWriter::write(value, writer, _write_resources, this);
+                writer.append_char('\n');
             }
         }
 
         if (E->next())
-            file->store_line(String());
+            writer.append_char('\n');
     }
 
-    if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF)
+    if (writer.flush_to(file) != OK)
         return ERR_CANT_CREATE;
 
     return OK;
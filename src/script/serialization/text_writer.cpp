@@ -0,0 +1,134 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/serialization/text_writer.h"
+
+#include "common/string_utils.h"
+
+#include <cmath>
+
+bool OScriptTextWriter::_is_plain_literal(const String& p_value, bool p_multiline)
+{
+    const char32_t* chars = p_value.ptr();
+    const int64_t length = p_value.length();
+    for (int64_t i = 0; i < length; i++)
+    {
+        const char32_t c = chars[i];
+        if (c >= 0x80 || c == '\\' || c == '"')
+            return false;
+
+        // C escapes also cover control characters and single quotes
+        if (!p_multiline && (c < 0x20 || c == '\''))
+            return false;
+    }
+    return true;
+}
+
+void OScriptTextWriter::append(const String& p_value)
+{
+    const char32_t* chars = p_value.ptr();
+    const int64_t length = p_value.length();
+
+    const uint32_t size = _data.size();
+    _data.resize(size + length);
+
+    uint8_t* out = _data.ptr() + size;
+    for (int64_t i = 0; i < length; i++)
+    {
+        if (chars[i] >= 0x80)
+        {
+            // Not ASCII, let String handle the encoding
+            _data.resize(size);
+            const CharString utf8 = p_value.utf8();
+            append(utf8.get_data(), utf8.length());
+            return;
+        }
+        out[i] = static_cast<uint8_t>(chars[i]);
+    }
+}
+
+void OScriptTextWriter::append_int(int64_t p_value)
+{
+    char buffer[24];
+    char* end = buffer + sizeof(buffer);
+    char* pos = end;
+
+    // Works on the unsigned magnitude, so that INT64_MIN does not overflow
+    uint64_t magnitude = p_value < 0 ? 0 - static_cast<uint64_t>(p_value) : static_cast<uint64_t>(p_value);
+    do
+    {
+        *--pos = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    }
+    while (magnitude);
+
+    if (p_value < 0)
+        *--pos = '-';
+
+    append(pos, end - pos);
+}
+
+void OScriptTextWriter::append_real(double p_value)
+{
+    if (p_value == 0.0)
+        append_char('0'); // Avoid negative (-0) written
+    else if (std::isnan(p_value))
+        append("nan");
+    else if (std::isinf(p_value))
+        append(p_value > 0 ? "inf" : "inf_neg");
+    else if (std::abs(p_value) < 1e6 && p_value == std::trunc(p_value))
+        append_int(static_cast<int64_t>(p_value)); // Whole numbers are written the same as integers
+    else
+        append(rtoss(p_value));
+}
+
+void OScriptTextWriter::append_literal(const String& p_value, bool p_multiline)
+{
+    append_char('"');
+    if (_is_plain_literal(p_value, p_multiline))
+    {
+        const char32_t* chars = p_value.ptr();
+        const int64_t length = p_value.length();
+
+        const uint32_t size = _data.size();
+        _data.resize(size + length);
+
+        uint8_t* out = _data.ptr() + size;
+        for (int64_t i = 0; i < length; i++)
+            out[i] = static_cast<uint8_t>(chars[i]);
+    }
+    else if (p_multiline)
+        append(StringUtils::c_escape_multiline(p_value));
+    else
+        append(p_value.c_escape());
+    append_char('"');
+}
+
+String OScriptTextWriter::get_string() const
+{
+    return String::utf8(reinterpret_cast<const char*>(_data.ptr()), _data.size());
+}
+
+Error OScriptTextWriter::flush_to(const Ref<FileAccess>& p_file) const
+{
+    ERR_FAIL_COND_V(!p_file.is_valid(), ERR_INVALID_PARAMETER);
+
+    if (!_data.is_empty())
+        p_file->store_buffer(_data.ptr(), _data.size());
+
+    const Error err = p_file->get_error();
+    return err == OK || err == ERR_FILE_EOF ? OK : err;
+}
@@ -0,0 +1,95 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_SERIALIZATION_TEXT_WRITER_H
+#define ORCHESTRATOR_SCRIPT_SERIALIZATION_TEXT_WRITER_H
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+/// An appendable UTF-8 byte buffer used to build text resources.
+///
+/// Values are encoded straight into UTF-8, avoiding the temporary <code>String</code> objects and the
+/// UTF-32 to UTF-8 conversion per value that building the text with string concatenation requires.
+/// ASCII text, integers, and short literals are appended directly; anything else falls back to the
+/// same conversions <code>String</code> would use, so the output is identical.
+class OScriptTextWriter
+{
+    LocalVector<uint8_t> _data;
+
+    /// Checks whether the characters can be written as-is inside a quoted literal
+    /// @param p_value the string
+    /// @param p_multiline whether newlines and control characters are kept as-is
+    /// @return true if no character requires escaping or UTF-8 encoding
+    static bool _is_plain_literal(const String& p_value, bool p_multiline);
+
+public:
+    /// Appends raw bytes
+    /// @param p_data the bytes, expected to be valid UTF-8
+    /// @param p_length the number of bytes
+    _FORCE_INLINE_ void append(const char* p_data, uint32_t p_length)
+    {
+        const uint32_t size = _data.size();
+        _data.resize(size + p_length);
+        memcpy(_data.ptr() + size, p_data, p_length);
+    }
+
+    /// Appends a null-terminated ASCII string
+    /// @param p_ascii the text
+    _FORCE_INLINE_ void append(const char* p_ascii) { append(p_ascii, strlen(p_ascii)); }
+
+    /// Appends a single ASCII character
+    /// @param p_char the character
+    _FORCE_INLINE_ void append_char(char p_char) { _data.push_back(static_cast<uint8_t>(p_char)); }
+
+    /// Appends a string, encoding it as UTF-8
+    /// @param p_value the string
+    void append(const String& p_value);
+
+    /// Appends an integer in decimal
+    /// @param p_value the value
+    void append_int(int64_t p_value);
+
+    /// Appends a real number, using the same representation as the text resource format
+    /// @param p_value the value
+    void append_real(double p_value);
+
+    /// Appends a quoted string literal, escaping characters as needed
+    /// @param p_value the string
+    /// @param p_multiline true to only escape backslashes and quotes, false to use C escapes
+    void append_literal(const String& p_value, bool p_multiline);
+
+    /// Get the number of bytes written
+    /// @return the buffer length
+    uint32_t size() const { return _data.size(); }
+
+    /// Discards the buffer contents
+    void clear() { _data.clear(); }
+
+    /// Get the buffer contents
+    /// @return the text
+    String get_string() const;
+
+    /// Writes the buffer contents to the file with a single call
+    /// @param p_file the file
+    /// @return the error code, <code>OK</code> if successful
+    Error flush_to(const Ref<FileAccess>& p_file) const;
+};
+
+#endif // ORCHESTRATOR_SCRIPT_SERIALIZATION_TEXT_WRITER_H
@@ -50,6 +50,15 @@ char32_t OScriptVariantParser::Stream::get_char()
     }
 }
 
+const char32_t* OScriptVariantParser::Stream::_consume_readahead(uint32_t& r_count)
+{
+    r_count = _readahead_pointer < _readahead_filled ? _readahead_filled - _readahead_pointer : 0;
+
+    const char32_t* chars = _readahead_buffer + _readahead_pointer;
+    _readahead_pointer = _readahead_filled;
+    return chars;
+}
+
 bool OScriptVariantParser::Stream::is_eof() const
 {
     if (_readahead_enabled)
@@ -85,6 +94,39 @@ uint32_t OScriptVariantParser::StreamFile::_read_buffer(char32_t* p_buffer, uint
     return read;
 }
 
+PackedByteArray OScriptVariantParser::StreamFile::read_remaining()
+{
+    uint32_t pending_count = 0;
+    const char32_t* pending = _consume_readahead(pending_count);
+
+    const uint32_t saved_count = saved ? 1 : 0;
+    const uint64_t position = data->get_position();
+    const uint64_t remaining = data->get_length() > position ? data->get_length() - position : 0;
+
+    // Sized once, the rest of the file is read directly into the array in a single call
+    PackedByteArray bytes;
+    bytes.resize(saved_count + pending_count + remaining);
+    uint8_t* w = bytes.ptrw();
+
+    if (saved)
+    {
+        w[0] = static_cast<uint8_t>(saved);
+        saved = 0;
+    }
+
+    for (uint32_t i = 0; i < pending_count; i++)
+        w[saved_count + i] = static_cast<uint8_t>(pending[i]);
+
+    if (remaining > 0)
+    {
+        const uint64_t read = data->get_buffer(w + saved_count + pending_count, remaining);
+        if (read < remaining)
+            bytes.resize(saved_count + pending_count + read);
+    }
+
+    return bytes;
+}
+
 bool OScriptVariantParser::StreamString::is_utf8() const
 {
     return false;
@@ -1903,21 +1945,61 @@ Error OScriptVariantParser::parse(Stream* p_stream, Variant& r_ret, String& r_er
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static String rtos_fix(double p_value)
+static void _write_real_tuple(OScriptTextWriter& r_writer, const char* p_name, const real_t* p_values, int p_count)
 {
-    if (p_value == 0.0)
-        return "0"; // Avoid negative (-0) written
-    else if (std::isnan(p_value))
-        return "nan";
-    else if (std::isinf(p_value))
+    r_writer.append(p_name);
+    r_writer.append_char('(');
+    for (int i = 0; i < p_count; i++)
     {
-        if (p_value > 0)
-            return "inf";
-        else
-            return "inf_neg";
+        if (i > 0)
+            r_writer.append(", ", 2);
+        r_writer.append_real(p_values[i]);
     }
+    r_writer.append_char(')');
+}
 
-    return rtoss(p_value);
+static void _write_int_tuple(OScriptTextWriter& r_writer, const char* p_name, const int32_t* p_values, int p_count)
+{
+    r_writer.append(p_name);
+    r_writer.append_char('(');
+    for (int i = 0; i < p_count; i++)
+    {
+        if (i > 0)
+            r_writer.append(", ", 2);
+        r_writer.append_int(p_values[i]);
+    }
+    r_writer.append_char(')');
+}
+
+template <typename T>
+static void _write_packed_ints(OScriptTextWriter& r_writer, const char* p_name, const T& p_array)
+{
+    r_writer.append(p_name);
+    r_writer.append_char('(');
+    const int64_t size = p_array.size();
+    for (int64_t i = 0; i < size; i++)
+    {
+        if (i > 0)
+            r_writer.append(", ", 2);
+        r_writer.append_int(p_array[i]);
+    }
+    r_writer.append_char(')');
+}
+
+template <typename T>
+static void _write_packed_reals(OScriptTextWriter& r_writer, const char* p_name, const T& p_array, int p_components)
+{
+    r_writer.append(p_name);
+    r_writer.append_char('(');
+    const int64_t size = p_array.size();
+    const auto* values = reinterpret_cast<const real_t*>(p_array.ptr());
+    for (int64_t i = 0; i < size * p_components; i++)
+    {
+        if (i > 0)
+            r_writer.append(", ", 2);
+        r_writer.append_real(values[i]);
+    }
+    r_writer.append_char(')');
 }
 
 bool OScriptVariantWriter::_is_resource_file(const String& p_path)
@@ -1925,209 +2007,211 @@ bool OScriptVariantWriter::_is_resource_file(const String& p_path)
     return p_path.begins_with("res://") && p_path.find("::") == -1;
 }
 
-Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction p_store_string, void* p_store_userdata, EncodeResourceFunction p_encode_resource, void* p_encode_userdata, int p_recursion_count)
+Error OScriptVariantWriter::write(const Variant& p_variant, OScriptTextWriter& r_writer, EncodeResourceFunction p_encode_resource, void* p_encode_userdata, int p_recursion_count)
 {
     switch (p_variant.get_type())
     {
         case Variant::NIL:
         {
-            p_store_string(p_store_userdata, "null");
+            r_writer.append("null");
             break;
         }
         case Variant::BOOL:
         {
-            p_store_string(p_store_userdata, p_variant.operator bool() ? "true" : "false");
+            r_writer.append(p_variant.operator bool() ? "true" : "false");
             break;
         }
         case Variant::INT:
         {
-            p_store_string(p_store_userdata, itos(p_variant.operator int64_t()));
+            r_writer.append_int(p_variant.operator int64_t());
             break;
         }
         case Variant::FLOAT:
         {
-            String s = rtos_fix(p_variant.operator double());
-            if (s != "inf" && s != "inf_neg" && s != "nan")
-                if (!s.contains(".") && !s.contains("e"))
-                    s += ".0";
-            p_store_string(p_store_userdata, s);
+            const double d = p_variant.operator double();
+            if (std::isnan(d) || std::isinf(d))
+            {
+                r_writer.append_real(d);
+                break;
+            }
+
+            // Floats always include a decimal point or exponent, so they are not read back as integers
+            if (d == 0.0 || (std::abs(d) < 1e6 && d == std::trunc(d)))
+            {
+                r_writer.append_real(d);
+                r_writer.append(".0", 2);
+                break;
+            }
+
+            String s = rtoss(d);
+            if (!s.contains(".") && !s.contains("e"))
+                s += ".0";
+            r_writer.append(s);
             break;
         }
         case Variant::STRING:
         {
-            String str = p_variant;
-            str = "\"" + StringUtils::c_escape_multiline(str) + "\"";
-            p_store_string(p_store_userdata, str);
+            r_writer.append_literal(p_variant, true);
             break;
         }
         case Variant::VECTOR2:
         {
             const Vector2 v = p_variant;
-            p_store_string(p_store_userdata, "Vector2(" + rtos_fix(v.x) + ", " + rtos_fix(v.y) + ")");
+            _write_real_tuple(r_writer, "Vector2", &v.x, 2);
             break;
         }
         case Variant::VECTOR2I:
         {
             const Vector2i v = p_variant;
-            p_store_string(p_store_userdata, "Vector2i(" + itos(v.x) + ", " + itos(v.y) + ")");
+            _write_int_tuple(r_writer, "Vector2i", &v.x, 2);
             break;
         }
         case Variant::RECT2:
         {
             const Rect2 r = p_variant;
-            p_store_string(p_store_userdata, "Rect2(" + rtos_fix(r.position.x) + ", " + rtos_fix(r.position.y) + ", " + rtos_fix(r.size.x) + ", " + rtos_fix(r.size.y) + ")");
+            const real_t values[4] = { r.position.x, r.position.y, r.size.x, r.size.y };
+            _write_real_tuple(r_writer, "Rect2", values, 4);
             break;
         }
         case Variant::RECT2I:
         {
             const Rect2i r = p_variant;
-            p_store_string(p_store_userdata, "Rect2i(" + itos(r.position.x) + ", " + itos(r.position.y) + ", " + itos(r.size.x) + ", " + itos(r.size.y) + ")");
+            const int32_t values[4] = { r.position.x, r.position.y, r.size.x, r.size.y };
+            _write_int_tuple(r_writer, "Rect2i", values, 4);
             break;
         }
         case Variant::VECTOR3:
         {
             const Vector3 v = p_variant;
-            p_store_string(p_store_userdata, "Vector3(" + rtos_fix(v.x) + ", " + rtos_fix(v.y) + ", " + rtos_fix(v.z) + ")");
+            _write_real_tuple(r_writer, "Vector3", &v.x, 3);
             break;
         }
         case Variant::VECTOR3I:
         {
             const Vector3i v = p_variant;
-            p_store_string(p_store_userdata, "Vector3i(" + itos(v.x) + ", " + itos(v.y) + ", " + itos(v.z) + ")");
+            _write_int_tuple(r_writer, "Vector3i", &v.x, 3);
             break;
         }
         case Variant::VECTOR4:
         {
             const Vector4 v = p_variant;
-            p_store_string(p_store_userdata, "Vector4(" + rtos_fix(v.x) + ", " + rtos_fix(v.y) + ", " + rtos_fix(v.z) + ", " + rtos_fix(v.w) + ")");
+            _write_real_tuple(r_writer, "Vector4", &v.x, 4);
             break;
         }
         case Variant::VECTOR4I:
         {
             const Vector4i v = p_variant;
-            p_store_string(p_store_userdata, "Vector4i(" + itos(v.x) + ", " + itos(v.y) + ", " + itos(v.z) + ", " + itos(v.w) + ")");
+            _write_int_tuple(r_writer, "Vector4i", &v.x, 4);
             break;
         }
         case Variant::PLANE:
         {
             const Plane p = p_variant;
-            p_store_string(p_store_userdata, "Plane(" + rtos_fix(p.normal.x) + ", " + rtos_fix(p.normal.y) + ", " + rtos_fix(p.normal.z) + ", " + rtos_fix(p.d) + ")");
+            const real_t values[4] = { p.normal.x, p.normal.y, p.normal.z, p.d };
+            _write_real_tuple(r_writer, "Plane", values, 4);
             break;
         }
         case Variant::AABB:
         {
             const AABB aabb = p_variant;
-            p_store_string(p_store_userdata, "AABB(" + rtos_fix(aabb.position.x) + ", " + rtos_fix(aabb.position.y) + ", " + rtos_fix(aabb.position.z) + ", " + rtos_fix(aabb.size.x) + ", " + rtos_fix(aabb.size.y) + ", " + rtos_fix(aabb.size.z) + ")");
+            const real_t values[6] = { aabb.position.x, aabb.position.y, aabb.position.z, aabb.size.x, aabb.size.y, aabb.size.z };
+            _write_real_tuple(r_writer, "AABB", values, 6);
             break;
         }
         case Variant::QUATERNION:
         {
             const Quaternion q = p_variant;
-            p_store_string(p_store_userdata, "Quaternion(" + rtos_fix(q.x) + ", " + rtos_fix(q.y) + ", " + rtos_fix(q.z) + ", " + rtos_fix(q.w) + ")");
+            const real_t values[4] = { q.x, q.y, q.z, q.w };
+            _write_real_tuple(r_writer, "Quaternion", values, 4);
             break;
         }
         case Variant::TRANSFORM2D:
         {
-            String s = "Transform2D(";
             const Transform2D t = p_variant;
+            real_t values[6];
             for (int i = 0; i < 3; i++)
             {
                 for (int j = 0; j < 2; j++)
-                {
-                    if (i != 0 || j != 0)
-                        s += ", ";
-                    s += rtos_fix(t.columns[i][j]);
-                }
+                    values[i * 2 + j] = t.columns[i][j];
             }
-            p_store_string(p_store_userdata, s + ")");
+            _write_real_tuple(r_writer, "Transform2D", values, 6);
             break;
         }
         case Variant::BASIS:
         {
-            String s = "Basis(";
             const Basis b = p_variant;
+            real_t values[9];
             for (int i = 0; i < 3; i++)
             {
                 for (int j = 0; j < 3; j++)
-                {
-                    if (i != 0 || j != 0)
-                        s += ", ";
-                    s += rtos_fix(b.rows[i][j]);
-                }
+                    values[i * 3 + j] = b.rows[i][j];
             }
-            p_store_string(p_store_userdata, s + ")");
+            _write_real_tuple(r_writer, "Basis", values, 9);
             break;
         }
         case Variant::TRANSFORM3D:
         {
-            String s = "Transform3D(";
             const Transform3D t = p_variant;
-            const Basis& m3 = t.basis;
+            real_t values[12];
             for (int i = 0; i < 3; i++)
             {
                 for (int j = 0; j < 3; j++)
-                {
-                    if (i != 0 || j != 0)
-                        s += ", ";
-                    s += rtos_fix(m3.rows[i][j]);
-                }
+                    values[i * 3 + j] = t.basis.rows[i][j];
             }
-            s = s + ", " + rtos_fix(t.origin.x) + ", " + rtos_fix(t.origin.y) + ", " + rtos_fix(t.origin.z);
-            p_store_string(p_store_userdata, s + ")");
+            values[9] = t.origin.x;
+            values[10] = t.origin.y;
+            values[11] = t.origin.z;
+            _write_real_tuple(r_writer, "Transform3D", values, 12);
             break;
         }
         case Variant::PROJECTION:
         {
-            String s = "Projection(";
             const Projection p = p_variant;
+            real_t values[16];
             for (int i = 0; i < 4; i++)
             {
                 for (int j = 0; j < 4; j++)
-                {
-                    if (i != 0 || j != 0)
-                        s += ", ";
-                    s += rtos_fix(p.columns[i][j]);
-                }
+                    values[i * 4 + j] = p.columns[i][j];
             }
-            p_store_string(p_store_userdata, s + ")");
+            _write_real_tuple(r_writer, "Projection", values, 16);
             break;
         }
         case Variant::COLOR:
         {
             const Color c = p_variant;
-            p_store_string(p_store_userdata, "Color(" + rtos_fix(c.r) + ", " + rtos_fix(c.g) + ", " + rtos_fix(c.b) + ", " + rtos_fix(c.a) + ")");
+            const real_t values[4] = { c.r, c.g, c.b, c.a };
+            _write_real_tuple(r_writer, "Color", values, 4);
             break;
         }
         case Variant::STRING_NAME:
         {
-            String str = p_variant;
-            str = "&\"" + str.c_escape() + "\"";
-            p_store_string(p_store_userdata, str);
+            r_writer.append_char('&');
+            r_writer.append_literal(p_variant, false);
             break;
         }
         case Variant::NODE_PATH:
         {
-            String str = p_variant;
-            str = "NodePath(\"" + str.c_escape() + "\")";
-            p_store_string(p_store_userdata, str);
+            r_writer.append("NodePath(");
+            r_writer.append_literal(p_variant, false);
+            r_writer.append_char(')');
             break;
         }
         case Variant::RID:
         {
             // RIDs are not stored
-            p_store_string(p_store_userdata, "RID()");
+            r_writer.append("RID()");
             break;
         }
         case Variant::SIGNAL:
         {
             // Signals are not stored
-            p_store_string(p_store_userdata, "Signal()");
+            r_writer.append("Signal()");
             break;
         }
         case Variant::CALLABLE:
         {
             // Callables are not stored
-            p_store_string(p_store_userdata, "Callable()");
+            r_writer.append("Callable()");
             break;
         }
         case Variant::OBJECT:
@@ -2135,7 +2219,7 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
             if (unlikely(p_recursion_count > MAX_RECURSION))
             {
                 ERR_PRINT("Max recursion reached");
-                p_store_string(p_store_userdata, "null");
+                r_writer.append("null");
                 return OK;
             }
             p_recursion_count++;
@@ -2143,7 +2227,7 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
             Object* obj = p_variant;
             if (!obj)
             {
-                p_store_string(p_store_userdata, "null");
+                r_writer.append("null");
                 break; // don't save it
             }
 
@@ -2164,13 +2248,13 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
                 // Could come up with some sort of text
                 if (!res_text.is_empty())
                 {
-                    p_store_string(p_store_userdata, res_text);
+                    r_writer.append(res_text);
                     break;
                 }
             }
 
             // Generic Object
-            p_store_string(p_store_userdata, "Object(" + obj->get_class() + ",");
+            r_writer.append("Object(" + obj->get_class() + ",");
 
             bool first{ true };
             List<PropertyInfo> properties = DictionaryUtils::to_properties(obj->get_property_list());
@@ -2181,13 +2265,13 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
                     if (first)
                         first = false;
                     else
-                        p_store_string(p_store_userdata, ",");
+                        r_writer.append(",");
 
-                    p_store_string(p_store_userdata, "\"" + property.name + "\":");
-                    write(obj->get(property.name), p_store_string, p_store_userdata, p_encode_resource, p_encode_userdata, p_recursion_count);
+                    r_writer.append("\"" + property.name + "\":");
+                    write(obj->get(property.name), r_writer, p_encode_resource, p_encode_userdata, p_recursion_count);
                 }
             }
-            p_store_string(p_store_userdata, ")\n");
+            r_writer.append(")\n");
             break;
         }
         case Variant::DICTIONARY:
@@ -2196,7 +2280,7 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
             if (unlikely(p_recursion_count > MAX_RECURSION))
             {
                 ERR_PRINT("Max recursion reached");
-                p_store_string(p_store_userdata, "{}");
+                r_writer.append("{}");
             }
             else
             {
@@ -2205,25 +2289,25 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
                 Array keys = dict.keys();
                 if (keys.is_empty())
                 {
-                    p_store_string(p_store_userdata, "{}");
+                    r_writer.append("{}");
                     break;
                 }
 
                 int size = keys.size();
-                p_store_string(p_store_userdata, "{\n");
+                r_writer.append("{\n");
 
                 for (int i = 0; i < size; i++)
                 {
                     const Variant& key = keys[i];
-                    write(key, p_store_string, p_store_userdata, p_encode_resource, p_encode_userdata, p_recursion_count);
-                    p_store_string(p_store_userdata, ": ");
-                    write(dict[key], p_store_string, p_store_userdata, p_encode_resource, p_encode_userdata, p_recursion_count);
+                    write(key, r_writer, p_encode_resource, p_encode_userdata, p_recursion_count);
+                    r_writer.append(": ");
+                    write(dict[key], r_writer, p_encode_resource, p_encode_userdata, p_recursion_count);
                     if ((i + 1) < size)
-                        p_store_string(p_store_userdata, ",\n");
+                        r_writer.append(",\n");
                     else
-                        p_store_string(p_store_userdata, "\n");
+                        r_writer.append("\n");
                 }
-                p_store_string(p_store_userdata, "}");
+                r_writer.append("}");
             }
             break;
         }
@@ -2232,7 +2316,7 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
             Array array = p_variant;
             if (array.get_typed_builtin() != Variant::NIL)
             {
-                p_store_string(p_store_userdata, "Array[");
+                r_writer.append("Array[");
 
                 Variant::Type builtin_type = (Variant::Type) array.get_typed_builtin();
                 StringName class_name = array.get_typed_class_name();
@@ -2249,182 +2333,135 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
                     if (res_text.is_empty())
                     {
                         ERR_PRINT("Failed to encode a path to a custom script for an array type.");
-                        p_store_string(p_store_userdata, class_name);
+                        r_writer.append(class_name);
                     }
                     else
-                        p_store_string(p_store_userdata, res_text);
+                        r_writer.append(res_text);
                 }
                 else if (class_name != StringName())
-                    p_store_string(p_store_userdata, class_name);
+                    r_writer.append(class_name);
                 else
-                    p_store_string(p_store_userdata, Variant::get_type_name(builtin_type));
+                    r_writer.append(Variant::get_type_name(builtin_type));
 
-                p_store_string(p_store_userdata, "](");
+                r_writer.append("](");
             }
 
             if (unlikely(p_recursion_count > MAX_RECURSION))
             {
                 ERR_PRINT("Max recursion reached");
-                p_store_string(p_store_userdata, "[]");
+                r_writer.append("[]");
             }
             else
             {
                 p_recursion_count++;
 
-                p_store_string(p_store_userdata, "[");
+                r_writer.append("[");
                 int size = array.size();
                 for (int i = 0; i < size; i++)
                 {
                     if (i > 0)
-                        p_store_string(p_store_userdata, ", ");
-                    write(array[i], p_store_string, p_store_userdata, p_encode_resource, p_encode_userdata, p_recursion_count);
+                        r_writer.append(", ");
+                    write(array[i], r_writer, p_encode_resource, p_encode_userdata, p_recursion_count);
                 }
-                p_store_string(p_store_userdata, "]");
+                r_writer.append("]");
             }
 
             if (array.get_typed_builtin() != Variant::NIL)
-                p_store_string(p_store_userdata, ")");
+                r_writer.append(")");
 
             break;
         }
         case Variant::PACKED_BYTE_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedByteArray(");
-            const PackedByteArray data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
-            {
-                if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, itos(data[i]));
-            }
-            p_store_string(p_store_userdata, ")");
+            _write_packed_ints(r_writer, "PackedByteArray", PackedByteArray(p_variant));
             break;
         }
         case Variant::PACKED_INT32_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedInt32Array(");
-            const PackedInt32Array data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
-            {
-                if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, itos(data[i]));
-            }
-            p_store_string(p_store_userdata, ")");
+            _write_packed_ints(r_writer, "PackedInt32Array", PackedInt32Array(p_variant));
             break;
         }
         case Variant::PACKED_INT64_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedInt64Array(");
-            const PackedInt64Array data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
-            {
-                if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, itos(data[i]));
-            }
-            p_store_string(p_store_userdata, ")");
+            _write_packed_ints(r_writer, "PackedInt64Array", PackedInt64Array(p_variant));
             break;
         }
         case Variant::PACKED_FLOAT32_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedFloat32Array(");
+            r_writer.append("PackedFloat32Array(");
             const PackedFloat32Array data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
+            const int64_t size = data.size();
+            for (int64_t i = 0; i < size; i++)
             {
                 if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, rtos_fix(data[i]));
+                    r_writer.append(", ", 2);
+                r_writer.append_real(data[i]);
             }
-            p_store_string(p_store_userdata, ")");
+            r_writer.append_char(')');
             break;
         }
         case Variant::PACKED_FLOAT64_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedFloat64Array(");
+            r_writer.append("PackedFloat64Array(");
             const PackedFloat64Array data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
+            const int64_t size = data.size();
+            for (int64_t i = 0; i < size; i++)
             {
                 if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, rtos_fix(data[i]));
+                    r_writer.append(", ", 2);
+                r_writer.append_real(data[i]);
             }
-            p_store_string(p_store_userdata, ")");
+            r_writer.append_char(')');
             break;
         }
         case Variant::PACKED_STRING_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedStringArray(");
+            r_writer.append("PackedStringArray(");
             const PackedStringArray data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
+            const int64_t size = data.size();
+            for (int64_t i = 0; i < size; i++)
             {
                 if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, "\"" + data[i].c_escape() + "\"");
+                    r_writer.append(", ", 2);
+                r_writer.append_literal(data[i], false);
             }
-            p_store_string(p_store_userdata, ")");
+            r_writer.append_char(')');
             break;
         }
         case Variant::PACKED_VECTOR2_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedVector2Array(");
-            const PackedVector2Array data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
-            {
-                if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, rtos_fix(data[i].x) + ", " + rtos_fix(data[i].y));
-            }
-            p_store_string(p_store_userdata, ")");
+            _write_packed_reals(r_writer, "PackedVector2Array", PackedVector2Array(p_variant), 2);
             break;
         }
         case Variant::PACKED_VECTOR3_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedVector3Array(");
-            const PackedVector3Array data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
-            {
-                if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, rtos_fix(data[i].x) + ", " + rtos_fix(data[i].y) + ", " + rtos_fix(data[i].z));
-            }
-            p_store_string(p_store_userdata, ")");
+            _write_packed_reals(r_writer, "PackedVector3Array", PackedVector3Array(p_variant), 3);
             break;
         }
         case Variant::PACKED_COLOR_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedColorArray(");
+            r_writer.append("PackedColorArray(");
             const PackedColorArray data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
+            const int64_t size = data.size();
+            for (int64_t i = 0; i < size; i++)
             {
                 if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, rtos_fix(data[i].r) + ", " + rtos_fix(data[i].g) + ", " + rtos_fix(data[i].b) + ", " + rtos(data[i].a));
+                    r_writer.append(", ", 2);
+
+                r_writer.append_real(data[i].r);
+                r_writer.append(", ", 2);
+                r_writer.append_real(data[i].g);
+                r_writer.append(", ", 2);
+                r_writer.append_real(data[i].b);
+                r_writer.append(", ", 2);
+                r_writer.append(rtos(data[i].a));
             }
-            p_store_string(p_store_userdata, ")");
+            r_writer.append_char(')');
             break;
         }
         case Variant::PACKED_VECTOR4_ARRAY:
         {
-            p_store_string(p_store_userdata, "PackedVector4Array(");
-            const PackedVector4Array data = p_variant;
-            int size = data.size();
-            for (int i = 0; i < size; i++)
-            {
-                if (i > 0)
-                    p_store_string(p_store_userdata, ", ");
-                p_store_string(p_store_userdata, rtos_fix(data[i].x) + ", " + rtos_fix(data[i].y) + ", " + rtos_fix(data[i].z) + ", " + rtos_fix(data[i].w));
-            }
-            p_store_string(p_store_userdata, ")");
+            _write_packed_reals(r_writer, "PackedVector4Array", PackedVector4Array(p_variant), 4);
             break;
         }
         default:
@@ -2436,15 +2473,20 @@ Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction
     return OK;
 }
 
-static Error _write_to_str(void* p_userdata, const String& p_string)
+Error OScriptVariantWriter::write(const Variant& p_variant, StoreStringFunction p_store_string, void* p_store_userdata, EncodeResourceFunction p_encode_resource, void* p_encode_userdata, int p_recursion_count)
 {
-    String* str = (String*) p_userdata;
-    (*str) += p_string;
-    return OK;
+    OScriptTextWriter writer;
+    const Error err = write(p_variant, writer, p_encode_resource, p_encode_userdata, p_recursion_count);
+    if (err == OK)
+        p_store_string(p_store_userdata, writer.get_string());
+
+    return err;
 }
 
 Error OScriptVariantWriter::write_to_string(const Variant& p_variant, String& r_string, EncodeResourceFunction p_encode_resource, void* p_encode_userdata)
 {
-    r_string = String();
-    return write(p_variant, _write_to_str, &r_string, p_encode_resource, p_encode_userdata);
+    OScriptTextWriter writer;
+    const Error err = write(p_variant, writer, p_encode_resource, p_encode_userdata);
+    r_string = writer.get_string();
+    return err;
 }
\ No newline at end of file
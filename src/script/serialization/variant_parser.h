@@ -17,6 +17,8 @@
 #ifndef ORCHESTRATOR_SCRIPT_VARIANT_PARSER_H
 #define ORCHESTRATOR_SCRIPT_VARIANT_PARSER_H
 
+#include "script/serialization/text_writer.h"
+
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
@@ -43,6 +45,11 @@ public:
         virtual uint32_t _read_buffer(char32_t* p_buffer, uint32_t p_num_chars) = 0;
         virtual bool _is_eof() const = 0;
 
+        /// Consumes the characters read ahead that have not yet been returned
+        /// @param r_count the number of characters
+        /// @return the characters
+        const char32_t* _consume_readahead(uint32_t& r_count);
+
     public:
         char32_t saved{ 0 };
 
@@ -69,6 +76,10 @@ public:
         bool is_utf8() const override;
         //~ End Stream Interface
 
+        /// Reads all unread bytes, including the saved character and those already read ahead
+        /// @return the remaining bytes of the file
+        PackedByteArray read_remaining();
+
         StreamFile(bool p_readahead_enabled = true) { _readahead_enabled = p_readahead_enabled; }
     };
 
@@ -170,6 +181,15 @@ public:
     typedef Error (*StoreStringFunction)(void* p_userdata, const String& p_string);
     typedef String (*EncodeResourceFunction)(void* p_userdata, const Ref<Resource>& p_resource);
 
+    /// Writes the variant in text resource format to the writer
+    /// @param p_variant the value
+    /// @param r_writer the UTF-8 writer
+    /// @param p_encode_resource the function to encode resource references, may be <code>nullptr</code>
+    /// @param p_encode_userdata the encode function userdata
+    /// @param p_recursion_count the current recursion depth
+    /// @return the error code, <code>OK</code> if successful
+    static Error write(const Variant& p_variant, OScriptTextWriter& r_writer, EncodeResourceFunction p_encode_resource, void* p_encode_userdata, int p_recursion_count = 0);
+
     static Error write(const Variant& p_variant, StoreStringFunction p_store_string, void* p_store_userdata, EncodeResourceFunction p_encode_resource, void* p_encode_userdata,int p_recursion_count = 0);
     static Error write_to_string(const Variant& p_variant, String& r_string, EncodeResourceFunction p_encode_resource = nullptr, void* p_encode_userdata = nullptr);
 };
@@ -0,0 +1,92 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/dispatch_table.h"
+
+#include "script/function.h"
+
+#include <godot_cpp/core/class_db.hpp>
+
+// Methods the engine may call on any object's script instance
+static const char* OBJECT_CALLBACKS[] = {
+    "_init",
+    "_notification",
+    "_to_string",
+    "_get",
+    "_set",
+    "_get_property_list",
+    "_validate_property",
+    "_property_can_revert",
+    "_property_get_revert",
+    nullptr
+};
+
+void OScriptDispatchTable::_add_missing(const StringName& p_name)
+{
+    const void* key = _get_key(p_name);
+    if (!key || _entries.has(key))
+        return;
+
+    _missing.push_back(p_name);
+    _entries[key] = MISSING;
+}
+
+void OScriptDispatchTable::build(const HashMap<StringName, Ref<OScriptFunction>>& p_functions, const StringName& p_base_type)
+{
+    _functions.clear();
+    _missing.clear();
+    _entries.clear();
+    _base_type = p_base_type;
+    _notification_index = MISSING;
+
+    for (const KeyValue<StringName, Ref<OScriptFunction>>& E : p_functions)
+    {
+        const int index = static_cast<int>(_functions.size());
+        _functions.push_back(E.key);
+        _entries[_get_key(E.key)] = index;
+    }
+
+    for (int i = 0; OBJECT_CALLBACKS[i]; i++)
+        _add_missing(OBJECT_CALLBACKS[i]);
+
+    // Virtual methods are only ever called by the engine, gather those of the base type and its parents
+    if (!p_base_type.is_empty() && ClassDB::class_exists(p_base_type))
+    {
+        const TypedArray<Dictionary> methods = ClassDB::class_get_method_list(p_base_type);
+        for (int i = 0; i < methods.size(); i++)
+        {
+            const Dictionary& method = methods[i];
+            if (static_cast<uint32_t>(method["flags"]) & METHOD_FLAG_VIRTUAL)
+                _add_missing(method["name"]);
+        }
+    }
+
+    _notification_index = lookup("_notification");
+}
+
+bool OScriptDispatchTable::matches(const HashMap<StringName, Ref<OScriptFunction>>& p_functions, const StringName& p_base_type) const
+{
+    if (p_base_type != _base_type || p_functions.size() != _functions.size())
+        return false;
+
+    for (const KeyValue<StringName, Ref<OScriptFunction>>& E : p_functions)
+    {
+        if (lookup(E.key) < 0)
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,106 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_DISPATCH_TABLE_H
+#define ORCHESTRATOR_SCRIPT_DISPATCH_TABLE_H
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+using namespace godot;
+
+/// Forward declarations
+class OScriptFunction;
+
+/// Maps method names called on a script's instances to compiled function indices.
+///
+/// The engine calls into script instances for many virtual callbacks, such as <code>_process</code>
+/// or <code>_notification</code>, regardless of whether the script implements them. The table holds
+/// an entry for each script function and for each engine virtual method of the script's base type
+/// the script does not implement, so that misses are answered without probing the function map.
+///
+/// Entries are keyed by the identity of the interned name rather than its hash, which avoids a call
+/// across the extension boundary for each lookup. The table is immutable once built and is shared
+/// by all instances of a script.
+///
+class OScriptDispatchTable : public RefCounted
+{
+    GDCLASS(OScriptDispatchTable, RefCounted);
+    static void _bind_methods() { }
+
+public:
+    /// The method is known not to be implemented by the script
+    static constexpr int MISSING = -1;
+
+    /// The method is not in the table, the caller must resolve it
+    static constexpr int UNKNOWN = -2;
+
+private:
+    LocalVector<StringName> _functions;       //! Function names, indexed by function index
+    LocalVector<StringName> _missing;         //! Known unimplemented names, held so their identity is stable
+    HashMap<const void*, int> _entries;       //! Maps interned name identity to function index or MISSING
+    StringName _base_type;                    //! The base type the virtual methods were gathered from
+    int _notification_index{ MISSING };       //! The index of the <code>_notification</code> function
+
+    /// Get the identity of an interned name
+    /// @param p_name the name
+    /// @return the identity, <code>nullptr</code> for an empty name
+    _FORCE_INLINE_ static const void* _get_key(const StringName& p_name)
+    {
+        return *reinterpret_cast<const void* const*>(p_name._native_ptr());
+    }
+
+    /// Adds a known unimplemented method
+    /// @param p_name the method name
+    void _add_missing(const StringName& p_name);
+
+public:
+    /// Builds the table
+    /// @param p_functions the script's functions
+    /// @param p_base_type the script's base type
+    void build(const HashMap<StringName, Ref<OScriptFunction>>& p_functions, const StringName& p_base_type);
+
+    /// Check whether the table still describes the specified functions
+    /// @param p_functions the script's functions
+    /// @param p_base_type the script's base type
+    /// @return true if the table matches, false if it should be rebuilt
+    bool matches(const HashMap<StringName, Ref<OScriptFunction>>& p_functions, const StringName& p_base_type) const;
+
+    /// Get the number of functions in the table
+    /// @return the function count
+    _FORCE_INLINE_ int get_function_count() const { return static_cast<int>(_functions.size()); }
+
+    /// Get the function name by index
+    /// @param p_index the function index
+    /// @return the function name
+    _FORCE_INLINE_ const StringName& get_function_name(int p_index) const { return _functions[p_index]; }
+
+    /// Get the index of the <code>_notification</code> function
+    /// @return the function index, or <code>MISSING</code> if not implemented
+    _FORCE_INLINE_ int get_notification_index() const { return _notification_index; }
+
+    /// Looks up a method name
+    /// @param p_name the method name
+    /// @return the function index, <code>MISSING</code> or <code>UNKNOWN</code>
+    _FORCE_INLINE_ int lookup(const StringName& p_name) const
+    {
+        const HashMap<const void*, int>::ConstIterator E = _entries.find(_get_key(p_name));
+        return E ? E->value : UNKNOWN;
+    }
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_DISPATCH_TABLE_H
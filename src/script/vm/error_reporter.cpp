@@ -0,0 +1,115 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/error_reporter.h"
+
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+// Errors that have not recurred within this many intervals are forgotten
+static constexpr uint64_t EXPIRE_INTERVALS = 10;
+
+void OScriptErrorReporter::set_interval(uint64_t p_msec)
+{
+    MutexLock lock(*_lock.ptr());
+    _interval_usec = p_msec * 1000;
+}
+
+bool OScriptErrorReporter::should_report(const ErrorKey& p_key)
+{
+    MutexLock lock(*_lock.ptr());
+    if (_interval_usec == 0)
+        return true;
+
+    const uint64_t now = Time::get_singleton()->get_ticks_usec();
+
+    HashMap<ErrorKey, ErrorEntry, ErrorKeyHasher>::Iterator E = _entries.find(p_key);
+    if (!E)
+    {
+        ErrorEntry entry;
+        entry.total = 1;
+        entry.first_usec = now;
+        entry.last_usec = now;
+        _entries.insert(p_key, entry);
+        return true;
+    }
+
+    E->value.total++;
+    E->value.pending++;
+    E->value.last_usec = now;
+    return false;
+}
+
+void OScriptErrorReporter::reported(const ErrorKey& p_key, const String& p_file, int p_line, const String& p_message)
+{
+    MutexLock lock(*_lock.ptr());
+
+    HashMap<ErrorKey, ErrorEntry, ErrorKeyHasher>::Iterator E = _entries.find(p_key);
+    if (E)
+    {
+        E->value.file = p_file;
+        E->value.line = p_line;
+        E->value.message = p_message;
+    }
+}
+
+void OScriptErrorReporter::flush(bool p_force)
+{
+    MutexLock lock(*_lock.ptr());
+    if (_entries.is_empty())
+        return;
+
+    const uint64_t now = Time::get_singleton()->get_ticks_usec();
+    if (!p_force && now - _last_flush_usec < _interval_usec)
+        return;
+
+    _last_flush_usec = now;
+
+    LocalVector<ErrorKey> expired;
+    for (KeyValue<ErrorKey, ErrorEntry>& E : _entries)
+    {
+        ErrorEntry& entry = E.value;
+        if (entry.pending > 0)
+        {
+            const String summary = vformat("%s (repeated %d more times, %d in total over %.1f seconds)",
+                entry.message, entry.pending, entry.total, (entry.last_usec - entry.first_usec) / 1000000.0);
+
+            _err_print_error(String(E.key.function).utf8().get_data(), entry.file.utf8().get_data(), entry.line,
+                             summary.utf8().get_data());
+
+            entry.pending = 0;
+        }
+        else if (p_force || now - entry.last_usec > _interval_usec * EXPIRE_INTERVALS)
+            expired.push_back(E.key);
+    }
+
+    for (const ErrorKey& key : expired)
+        _entries.erase(key);
+}
+
+void OScriptErrorReporter::clear()
+{
+    MutexLock lock(*_lock.ptr());
+    _entries.clear();
+}
+
+OScriptErrorReporter::OScriptErrorReporter()
+{
+    _lock.instantiate();
+}
@@ -0,0 +1,111 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_ERROR_REPORTER_H
+#define ORCHESTRATOR_SCRIPT_ERROR_REPORTER_H
+
+#include <godot_cpp/classes/mutex.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using namespace godot;
+
+/// Aggregates runtime errors raised by orchestrations.
+///
+/// A failing node inside a per-frame callback raises the same error every frame for every script
+/// instance, which floods the log and hides the original error. The first occurrence of an error
+/// is reported in full, as it was before aggregation. Later occurrences of the same error, keyed
+/// by script, function, node, and error kind, are only counted and periodically reported as a
+/// single summary line. An error that stops recurring is forgotten, so it is reported in full again
+/// if it reappears later.
+///
+class OScriptErrorReporter
+{
+public:
+    /// Identifies an error source
+    struct ErrorKey
+    {
+        const void* script{ nullptr };  //! The script that raised the error
+        StringName function;            //! The function that was executing
+        int node{ -1 };                 //! The node that raised the error
+        int kind{ 0 };                  //! The call error kind
+
+        bool operator==(const ErrorKey& p_other) const
+        {
+            return script == p_other.script && node == p_other.node && kind == p_other.kind && function == p_other.function;
+        }
+    };
+
+    struct ErrorKeyHasher
+    {
+        static uint32_t hash(const ErrorKey& p_key)
+        {
+            uint32_t h = hash_murmur3_one_64(reinterpret_cast<uint64_t>(p_key.script));
+            h = hash_murmur3_one_32(p_key.function.hash(), h);
+            h = hash_murmur3_one_32(static_cast<uint32_t>(p_key.node), h);
+            h = hash_murmur3_one_32(static_cast<uint32_t>(p_key.kind), h);
+            return hash_fmix32(h);
+        }
+    };
+
+private:
+    struct ErrorEntry
+    {
+        String file;                   //! Script path, captured when first reported
+        String message;                //! Error message, captured when first reported
+        int line{ -1 };                //! Reported line, the node id
+        uint64_t total{ 0 };           //! Number of occurrences since first reported
+        uint64_t pending{ 0 };         //! Occurrences not yet included in a summary
+        uint64_t first_usec{ 0 };      //! Time of the first occurrence
+        uint64_t last_usec{ 0 };       //! Time of the most recent occurrence
+    };
+
+    Ref<Mutex> _lock;                                          //! Guards the entries
+    HashMap<ErrorKey, ErrorEntry, ErrorKeyHasher> _entries;    //! Known errors
+    uint64_t _interval_usec{ 1000000 };                        //! Time between summaries, 0 disables aggregation
+    uint64_t _last_flush_usec{ 0 };                            //! Time summaries were last written
+
+public:
+    /// Set the interval between summaries
+    /// @param p_msec the interval in milliseconds, 0 reports every occurrence in full
+    void set_interval(uint64_t p_msec);
+
+    /// Counts an occurrence of the error, returning whether it should be reported in full.
+    /// @param p_key the error source
+    /// @return true if the error should be reported now, false if it was counted toward a summary
+    bool should_report(const ErrorKey& p_key);
+
+    /// Records the details of an error that was reported in full, used for its summary lines
+    /// @param p_key the error source
+    /// @param p_file the script path
+    /// @param p_line the reported line
+    /// @param p_message the error message
+    void reported(const ErrorKey& p_key, const String& p_file, int p_line, const String& p_message);
+
+    /// Writes summary lines for repeated errors, if the interval has elapsed
+    /// @param p_force whether to write summaries regardless of the interval
+    void flush(bool p_force = false);
+
+    /// Forgets all errors
+    void clear();
+
+    /// Constructor
+    OScriptErrorReporter();
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_ERROR_REPORTER_H
@@ -56,6 +56,17 @@ Object* OScriptExecutionContext::get_owner()
     return _instance->get_owner();
 }
 
+void OScriptExecutionContext::request_tail_call(const StringName& p_method, const Variant* const* p_args, int p_arg_count)
+{
+    ERR_FAIL_NULL_MSG(_tail_call, "Tail calls are not permitted in this context");
+
+    _tail_call->pending = true;
+    _tail_call->method = p_method;
+    _tail_call->args.resize(p_arg_count);
+    for (int i = 0; i < p_arg_count; i++)
+        _tail_call->args[i] = *p_args[i];
+}
+
 void OScriptExecutionContext::set_error(GDExtensionCallError& p_error, const String& p_reason)
 {
     if (_error)
@@ -140,6 +151,7 @@ void OScriptExecutionContext::copy_input_to_output(size_t p_input_index, size_t
 OScriptExecutionContext::OScriptExecutionContext(OScriptExecutionStackInfo p_stack_info, void* p_stack, int p_flow_position, int p_passes)
     : _info(p_stack_info)
     , _stack(p_stack)
+    , _frames(&OScriptFrameStack::get_thread_stack())
 {
     assert(_stack != nullptr);
 
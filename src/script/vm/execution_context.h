@@ -17,6 +17,11 @@
 #ifndef ORCHESTRATOR_SCRIPT_EXECUTION_CONTEXT_H
 #define ORCHESTRATOR_SCRIPT_EXECUTION_CONTEXT_H
 
+#include "script/vm/frame_stack.h"
+
+#include <type_traits>
+
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 using namespace godot;
@@ -59,6 +64,14 @@ struct OScriptExecutionStackInfo
     int get_stack_size() const;
 };
 
+/// Describes a call that replaces the current function call, reusing its frame
+struct OScriptTailCall
+{
+    bool pending{ false };       //! Whether a tail call was requested
+    StringName method;           //! The function to call
+    LocalVector<Variant> args;   //! The arguments, copied out of the caller's frame
+};
+
 /// The main script execution context which manages the execution state, stack and other runtime details.
 class OScriptExecutionContext
 {
@@ -88,6 +101,9 @@ protected:
     int _current_node_working_memory{ 0 };        //! The current node working memory position
     Variant* _working_memory{ nullptr };          //! The working memory
 
+    OScriptTailCall* _tail_call{ nullptr };       //! The tail call request, when tail calls are permitted
+    OScriptFrameStack* _frames{ nullptr };        //! The thread's frame stack, also used for step scratch memory
+
     GDExtensionCallError* _error{ nullptr };      //! The call error reference
     String _error_reason;                         //! The error reason
 
@@ -180,6 +196,10 @@ public:
     /// @return the owning virtual machine
     _FORCE_INLINE_ OScriptVirtualMachine* get_runtime() { return _instance; }
 
+    /// Get the script instance that is executing
+    /// @return the script instance
+    _FORCE_INLINE_ OScriptInstance* get_script_instance() { return _script_instance; }
+
     /// Gets the owner object, typically the owner of the virtual machine.
     /// @return the owner object, should never be <code>null</code>.
     Object* get_owner();
@@ -217,6 +237,29 @@ public:
     /// @return true if the node has been executed, false otherwise
     _FORCE_INLINE_ bool has_node_executed(int p_index) const { return _execution_stack[p_index]; }
 
+    /// Checks whether a call in tail position can replace this function call
+    /// @return true if tail calls are permitted, false otherwise
+    _FORCE_INLINE_ bool can_tail_call() const { return _tail_call != nullptr; }
+
+    /// Requests that the function returns the result of calling another function of the script,
+    /// reusing the current frame rather than nesting the call.
+    /// @param p_method the function to call
+    /// @param p_args the arguments
+    /// @param p_arg_count the number of arguments
+    void request_tail_call(const StringName& p_method, const Variant* const* p_args, int p_arg_count);
+
+    /// Allocates scratch memory for the executing step from the thread's frame stack. The memory is
+    /// released as soon as the step completes, without running destructors, so it must only hold
+    /// trivially destructible values that do not outlive the step, such as argument pointer arrays.
+    /// @param p_count the number of elements
+    /// @return the uninitialized elements
+    template <typename T>
+    _FORCE_INLINE_ T* allocate_scratch(uint32_t p_count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Scratch memory is released without destruction");
+        return static_cast<T*>(_frames->push(sizeof(T) * p_count));
+    }
+
     //~ Begin Error Interface
     _FORCE_INLINE_ bool has_error() const { return _error && _error->error != GDEXTENSION_CALL_OK; }
     GDExtensionCallError& get_error() { return *_error; }
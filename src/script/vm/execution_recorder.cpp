@@ -0,0 +1,226 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/execution_recorder.h"
+
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+void OScriptExecutionRecorder::_add_event(int p_track, EventType p_type, const StringName& p_method, const Array& p_values)
+{
+    MutexLock lock(*_lock.ptr());
+    if (!_recording || p_track < 0 || p_track >= _track_count)
+        return;
+
+    _event_tracks.push_back(p_track);
+    _event_types.push_back(static_cast<uint8_t>(p_type));
+    if (p_type == EVENT_CALL)
+        _event_methods.push_back(p_method);
+    _event_values.push_back(p_values);
+
+    if (static_cast<uint32_t>(_event_types.size()) >= MAX_PENDING_EVENTS)
+        _write_pending();
+}
+
+void OScriptExecutionRecorder::_write_pending()
+{
+    if (!_file.is_valid())
+        return;
+
+    // Tracks are written first, as pending events may refer to them
+    for (int i = 0; i < _pending_tracks.size(); i++)
+        _file->store_var(_pending_tracks[i]);
+    _pending_tracks.clear();
+
+    if (!_event_types.is_empty())
+    {
+        Array record;
+        record.push_back(static_cast<int>(RECORD_EVENTS));
+        record.push_back(_event_tracks);
+        record.push_back(_event_types);
+        record.push_back(_event_methods);
+        record.push_back(_event_values);
+        _file->store_var(record);
+
+        _event_tracks.clear();
+        _event_types.clear();
+        _event_methods.clear();
+        _event_values = Array();
+    }
+
+    _file->flush();
+    _last_flush_usec = Time::get_singleton()->get_ticks_usec();
+}
+
+Error OScriptExecutionRecorder::start(const String& p_path)
+{
+    MutexLock lock(*_lock.ptr());
+
+    _file = FileAccess::open(p_path, FileAccess::WRITE);
+    ERR_FAIL_COND_V_MSG(!_file.is_valid(), FileAccess::get_open_error(), "Failed to open execution recording: " + p_path);
+
+    _file->store_32(MAGIC);
+    _file->store_32(VERSION);
+    _file->flush();
+
+    _track_count = 0;
+    _last_flush_usec = Time::get_singleton()->get_ticks_usec();
+    _recording = true;
+
+    return OK;
+}
+
+void OScriptExecutionRecorder::stop()
+{
+    MutexLock lock(*_lock.ptr());
+    if (!_recording)
+        return;
+
+    _recording = false;
+    _write_pending();
+    _file.unref();
+}
+
+void OScriptExecutionRecorder::flush(bool p_force)
+{
+    MutexLock lock(*_lock.ptr());
+    if (!_recording)
+        return;
+
+    if (!p_force && Time::get_singleton()->get_ticks_usec() - _last_flush_usec < _interval_usec)
+        return;
+
+    _write_pending();
+}
+
+int OScriptExecutionRecorder::add_track(const String& p_script_path, const OScriptRandomStream& p_random)
+{
+    MutexLock lock(*_lock.ptr());
+    if (!_recording)
+        return -1;
+
+    Array record;
+    record.push_back(static_cast<int>(RECORD_TRACK));
+    record.push_back(p_script_path);
+    record.push_back(static_cast<int64_t>(p_random.get_state()));
+    record.push_back(static_cast<int64_t>(p_random.get_increment()));
+    _pending_tracks.push_back(record);
+
+    return _track_count++;
+}
+
+void OScriptExecutionRecorder::record_call(int p_track, const StringName& p_method, const Variant* const* p_args, int p_arg_count)
+{
+    Array values;
+    values.resize(p_arg_count);
+    for (int i = 0; i < p_arg_count; i++)
+        values[i] = *p_args[i];
+
+    _add_event(p_track, EVENT_CALL, p_method, values);
+}
+
+void OScriptExecutionRecorder::record_result(int p_track, const Variant& p_value)
+{
+    Array values;
+    values.push_back(p_value);
+
+    _add_event(p_track, EVENT_RESULT, StringName(), values);
+}
+
+void OScriptExecutionRecorder::record_step(int p_track, const Array& p_values)
+{
+    _add_event(p_track, EVENT_STEP, StringName(), p_values);
+}
+
+Error OScriptExecutionRecorder::decode(const PackedByteArray& p_data, LocalVector<Track>& r_tracks)
+{
+    r_tracks.clear();
+
+    ERR_FAIL_COND_V_MSG(p_data.size() < 8 || p_data.decode_u32(0) != MAGIC, ERR_FILE_UNRECOGNIZED, "Not an execution recording");
+    ERR_FAIL_COND_V_MSG(p_data.decode_u32(4) != VERSION, ERR_FILE_UNRECOGNIZED, "Unsupported execution recording version");
+
+    // Each record is written with store_var, as its encoded length followed by the encoded value
+    int64_t offset = 8;
+    while (offset + 4 <= p_data.size())
+    {
+        const int64_t length = p_data.decode_u32(offset);
+        offset += 4;
+
+        if (offset + length > p_data.size())
+        {
+            WARN_PRINT("Execution recording ends with an incomplete batch, which is ignored.");
+            break;
+        }
+
+        const Variant decoded = UtilityFunctions::bytes_to_var(p_data.slice(offset, offset + length));
+        offset += length;
+
+        ERR_FAIL_COND_V_MSG(decoded.get_type() != Variant::ARRAY, ERR_FILE_CORRUPT, "Execution recording has an invalid record");
+        const Array record = decoded;
+        ERR_FAIL_COND_V_MSG(record.is_empty(), ERR_FILE_CORRUPT, "Execution recording has an invalid record");
+
+        const int type = record[0];
+        if (type == RECORD_TRACK)
+        {
+            ERR_FAIL_COND_V_MSG(record.size() != 4, ERR_FILE_CORRUPT, "Execution recording has an invalid track");
+
+            Track track;
+            track.script_path = record[1];
+            track.random.restore(static_cast<int64_t>(record[2]), static_cast<int64_t>(record[3]));
+            r_tracks.push_back(track);
+        }
+        else if (type == RECORD_EVENTS)
+        {
+            ERR_FAIL_COND_V_MSG(record.size() != 5, ERR_FILE_CORRUPT, "Execution recording has an invalid batch");
+
+            const PackedInt32Array tracks = record[1];
+            const PackedByteArray types = record[2];
+            const PackedStringArray methods = record[3];
+            const Array values = record[4];
+            ERR_FAIL_COND_V_MSG(tracks.size() != types.size() || types.size() != values.size(), ERR_FILE_CORRUPT,
+                "Execution recording has an invalid batch");
+
+            int method_index = 0;
+            for (int i = 0; i < types.size(); i++)
+            {
+                ERR_FAIL_COND_V_MSG(tracks[i] < 0 || tracks[i] >= static_cast<int>(r_tracks.size()), ERR_FILE_CORRUPT,
+                    "Execution recording has an event for an unknown track");
+
+                Event event;
+                event.type = static_cast<EventType>(types[i]);
+                event.values = values[i];
+                if (event.type == EVENT_CALL)
+                {
+                    ERR_FAIL_COND_V_MSG(method_index >= methods.size(), ERR_FILE_CORRUPT, "Execution recording has an invalid batch");
+                    event.method = methods[method_index++];
+                }
+                r_tracks[tracks[i]].events.push_back(event);
+            }
+        }
+        else
+        {
+            ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Execution recording has an unknown record type");
+        }
+    }
+
+    return OK;
+}
+
+OScriptExecutionRecorder::OScriptExecutionRecorder()
+{
+    _lock.instantiate();
+}
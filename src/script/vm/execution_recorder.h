@@ -0,0 +1,176 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_EXECUTION_RECORDER_H
+#define ORCHESTRATOR_SCRIPT_EXECUTION_RECORDER_H
+
+#include "script/vm/random_stream.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/mutex.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using namespace godot;
+
+/// Records the external inputs consumed by orchestrations, so that a session can be replayed.
+///
+/// Each script instance records its own track, starting with the state of its random stream. The
+/// track then holds an event for each call into the instance from outside of its own graph, such
+/// as engine callbacks with their delta times or signal callbacks with their arguments, an event
+/// for the result of each call the graph makes to the engine or other objects, and an event with
+/// the outputs of each node that reads external state, such as pure calls, property reads, and
+/// input. Calls between functions of the same script are not recorded, as replaying the graph
+/// reproduces them.
+///
+/// Events are written to the recording file in batches while the session runs, so a recording
+/// survives the session crashing, losing at most the last unwritten batch.
+///
+/// Values are encoded with <code>var_to_bytes</code>, so objects are recorded as <code>null</code>.
+/// Execution resumed after an await is not recorded.
+///
+class OScriptExecutionRecorder
+{
+public:
+    /// The recording format version
+    static constexpr uint32_t VERSION = 2;
+
+    /// Identifies a recording file
+    static constexpr uint32_t MAGIC = 0x4345524F; // "OREC"
+
+    /// Pending events that are written immediately, regardless of the flush interval
+    static constexpr uint32_t MAX_PENDING_EVENTS = 4096;
+
+    enum EventType
+    {
+        EVENT_CALL,    //! A call into the instance, values are the arguments
+        EVENT_RESULT,  //! The result of an external call made by the graph
+        EVENT_STEP     //! A node that reads external state, values are the node id, step result, and outputs
+    };
+
+    struct Event
+    {
+        EventType type{ EVENT_CALL };
+        StringName method;            //! The method called, for call events
+        Array values;                 //! The call arguments, the single result value, or the step values
+    };
+
+    struct Track
+    {
+        String script_path;           //! The script the instance runs
+        OScriptRandomStream random;   //! The instance's random stream when recording started
+        LocalVector<Event> events;    //! The events, in the order they were consumed
+    };
+
+    /// The position of a replaying instance within its track
+    struct Cursor
+    {
+        const Track* track{ nullptr };
+        uint32_t position{ 0 };
+        uint32_t divergences{ 0 };    //! Events the graph expected that did not match the recording
+
+        _FORCE_INLINE_ bool has_next(EventType p_type) const
+        {
+            return position < track->events.size() && track->events[position].type == p_type;
+        }
+    };
+
+private:
+    enum RecordType
+    {
+        RECORD_TRACK,                 //! A new track, as [type, path, state, increment]
+        RECORD_EVENTS                 //! A batch of events, as [type, tracks, types, methods, values]
+    };
+
+    Ref<Mutex> _lock;                 //! Guards the pending records and file
+    Ref<FileAccess> _file;            //! The recording file, while recording
+    int _track_count{ 0 };            //! Tracks added since recording started
+    Array _pending_tracks;            //! Track records not yet written
+    PackedInt32Array _event_tracks;   //! Track index of each pending event
+    PackedByteArray _event_types;     //! Type of each pending event
+    PackedStringArray _event_methods; //! Method of each pending call event
+    Array _event_values;              //! Values of each pending event
+    uint64_t _interval_usec{ 1000000 }; //! Time between writes
+    uint64_t _last_flush_usec{ 0 };   //! Time pending records were last written
+    bool _recording{ false };         //! Whether recording is active
+
+    /// Appends a pending event, writing pending records if too many are pending
+    /// @param p_track the track index
+    /// @param p_type the event type
+    /// @param p_method the method, for call events
+    /// @param p_values the event values
+    void _add_event(int p_track, EventType p_type, const StringName& p_method, const Array& p_values);
+
+    /// Writes pending records to the file, the lock must be held
+    void _write_pending();
+
+public:
+    /// Check whether recording is active
+    /// @return true if recording, false otherwise
+    _FORCE_INLINE_ bool is_recording() const { return _recording; }
+
+    /// Starts recording to the specified file, replacing it
+    /// @param p_path the recording file path
+    /// @return the error code, <code>OK</code> if successful
+    Error start(const String& p_path);
+
+    /// Stops recording, writing any pending events and closing the file
+    void stop();
+
+    /// Writes pending events to the file, if the interval has elapsed
+    /// @param p_force whether to write regardless of the interval
+    void flush(bool p_force = false);
+
+    /// Adds a track for a script instance
+    /// @param p_script_path the script path
+    /// @param p_random the instance's random stream
+    /// @return the track index
+    int add_track(const String& p_script_path, const OScriptRandomStream& p_random);
+
+    /// Records a call into a script instance
+    /// @param p_track the track index
+    /// @param p_method the method called
+    /// @param p_args the arguments
+    /// @param p_arg_count the number of arguments
+    void record_call(int p_track, const StringName& p_method, const Variant* const* p_args, int p_arg_count);
+
+    /// Records the result of an external call made by the graph
+    /// @param p_track the track index
+    /// @param p_value the result
+    void record_result(int p_track, const Variant& p_value);
+
+    /// Records the step result and outputs of a node that reads external state
+    /// @param p_track the track index
+    /// @param p_values the node id, step result, and output values
+    void record_step(int p_track, const Array& p_values);
+
+    /// Decodes a recording. A recording that ends in a partially written batch, such as when the
+    /// session crashed, is decoded up to the last complete batch.
+    /// @param p_data the encoded recording
+    /// @param r_tracks the decoded tracks
+    /// @return the error code, <code>OK</code> if successful
+    static Error decode(const PackedByteArray& p_data, LocalVector<Track>& r_tracks);
+
+    /// Constructor
+    OScriptExecutionRecorder();
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_EXECUTION_RECORDER_H
@@ -0,0 +1,134 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/execution_replayer.h"
+
+#include "common/logger.h"
+#include "script/instances/script_instance.h"
+#include "script/language.h"
+#include "script/script.h"
+#include "script/vm/execution_recorder.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+void OScriptExecutionReplayer::_bind_methods()
+{
+    ClassDB::bind_method(D_METHOD("replay", "data"), &OScriptExecutionReplayer::replay);
+    ClassDB::bind_method(D_METHOD("replay_file", "path"), &OScriptExecutionReplayer::replay_file);
+}
+
+Dictionary OScriptExecutionReplayer::replay(const PackedByteArray& p_data)
+{
+    Dictionary results;
+
+    LocalVector<OScriptExecutionRecorder::Track> tracks;
+    ERR_FAIL_COND_V_MSG(OScriptExecutionRecorder::decode(p_data, tracks) != OK, results, "Failed to decode execution recording");
+
+    Time* time = Time::get_singleton();
+
+    Dictionary functions;
+    uint64_t total_usec = 0;
+    int calls = 0;
+    int errors = 0;
+    int unconsumed = 0;
+    int divergences = 0;
+
+    for (const OScriptExecutionRecorder::Track& track : tracks)
+    {
+        const Ref<OScript> script = ResourceLoader::get_singleton()->load(track.script_path);
+        if (!script.is_valid())
+        {
+            ERR_PRINT("Cannot replay track, failed to load script " + track.script_path);
+            errors++;
+            continue;
+        }
+
+        const Variant owner_value = ClassDB::instantiate(script->get_instance_base_type());
+        Object* owner = owner_value;
+        if (!owner)
+        {
+            ERR_PRINT("Cannot replay track, failed to create " + script->get_instance_base_type() + " for " + track.script_path);
+            errors++;
+            continue;
+        }
+
+        OScriptInstance* instance = memnew(OScriptInstance(script, OScriptLanguage::get_singleton(), owner));
+
+        OScriptExecutionRecorder::Cursor cursor;
+        cursor.track = &track;
+        instance->_vm.start_replay(&cursor);
+
+        while (cursor.position < track.events.size())
+        {
+            // Results left over when the graph no longer makes the recorded external calls
+            if (!cursor.has_next(OScriptExecutionRecorder::EVENT_CALL))
+            {
+                cursor.position++;
+                unconsumed++;
+                continue;
+            }
+
+            const String key = track.script_path + "::" + track.events[cursor.position].method;
+
+            Variant result;
+            GDExtensionCallError err;
+            err.error = GDEXTENSION_CALL_OK;
+
+            const uint64_t start = time->get_ticks_usec();
+            instance->_vm.replay_call(instance, result, err);
+            const uint64_t elapsed = time->get_ticks_usec() - start;
+
+            if (err.error != GDEXTENSION_CALL_OK)
+                errors++;
+
+            Dictionary entry = functions.get(key, Dictionary());
+            entry["calls"] = static_cast<int64_t>(entry.get("calls", 0)) + 1;
+            entry["usec"] = static_cast<int64_t>(entry.get("usec", 0)) + static_cast<int64_t>(elapsed);
+            functions[key] = entry;
+
+            total_usec += elapsed;
+            calls++;
+        }
+
+        divergences += static_cast<int>(cursor.divergences);
+
+        memdelete(instance);
+
+        // Reference counted owners are released with the variant
+        if (!Object::cast_to<RefCounted>(owner))
+            memdelete(owner);
+    }
+
+    results["total_usec"] = static_cast<int64_t>(total_usec);
+    results["calls"] = calls;
+    results["errors"] = errors;
+    results["unconsumed_results"] = unconsumed;
+    results["divergences"] = divergences;
+    results["functions"] = functions;
+
+    Logger::info("Replayed ", calls, " calls across ", static_cast<int64_t>(tracks.size()), " instances in ", total_usec / 1000.0, " ms");
+
+    return results;
+}
+
+Dictionary OScriptExecutionReplayer::replay_file(const String& p_path)
+{
+    ERR_FAIL_COND_V_MSG(!FileAccess::file_exists(p_path), Dictionary(), "Execution recording not found: " + p_path);
+    return replay(FileAccess::get_file_as_bytes(p_path));
+}
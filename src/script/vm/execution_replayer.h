@@ -0,0 +1,58 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_EXECUTION_REPLAYER_H
+#define ORCHESTRATOR_SCRIPT_EXECUTION_REPLAYER_H
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+using namespace godot;
+
+/// Replays a session recorded by <code>OScriptExecutionRecorder</code>, timing each call.
+///
+/// Each recorded track is replayed against a new instance of its script, whose owner is a bare
+/// object of the script's base type that is not part of any scene. Calls into the instance are
+/// made with the recorded arguments, and calls the graph makes outside of the script return the
+/// recorded results rather than calling the engine. Nodes that read external state, such as pure
+/// calls, property reads, and input, output their recorded values. A replay therefore runs headless
+/// and reproduces the recorded execution for as long as the scripts are unchanged.
+///
+/// The result is a dictionary with the total and per-function call counts and timings, allowing
+/// a recorded session to be used as a repeatable benchmark. It also counts divergences, where the
+/// graph expected a recorded value that does not match the recording, such as after a script edit.
+///
+class OScriptExecutionReplayer : public RefCounted
+{
+    GDCLASS(OScriptExecutionReplayer, RefCounted);
+
+protected:
+    static void _bind_methods();
+
+public:
+    /// Replays a recording
+    /// @param p_data the encoded recording
+    /// @return the replay timings
+    Dictionary replay(const PackedByteArray& p_data);
+
+    /// Replays a recording stored in a file
+    /// @param p_path the recording file path
+    /// @return the replay timings
+    Dictionary replay_file(const String& p_path);
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_EXECUTION_REPLAYER_H
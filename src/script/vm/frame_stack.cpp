@@ -0,0 +1,96 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/frame_stack.h"
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+
+void OScriptFrameStack::_rewind_segments(const Mark& p_mark)
+{
+    // Segments after the current one must stay empty
+    for (uint32_t i = p_mark.segment + 1; i <= _current && i < _segments.size(); i++)
+        _segments[i].used = 0;
+
+    _current = p_mark.segment;
+    if (_current < _segments.size())
+        _segments[_current].used = p_mark.used;
+}
+
+OScriptFrameStack& OScriptFrameStack::get_thread_stack()
+{
+    static thread_local OScriptFrameStack stack;
+    return stack;
+}
+
+void* OScriptFrameStack::push(uint64_t p_size)
+{
+    const uint64_t size = (p_size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+    if (_current < _segments.size())
+    {
+        Segment& segment = _segments[_current];
+        if (segment.size - segment.used >= size)
+        {
+            void* frame = segment.data + segment.used;
+            segment.used += size;
+            return frame;
+        }
+
+        // Segments after the current one are always empty, move to the next
+        if (segment.used > 0)
+            _current++;
+    }
+
+    if (_current >= _segments.size())
+        _segments.push_back(Segment());
+
+    // Replace a previously allocated segment that is too small for the frame
+    Segment& segment = _segments[_current];
+    if (segment.size < size)
+    {
+        if (segment.data)
+            memfree(segment.data);
+
+        segment.size = MAX(size, SEGMENT_SIZE);
+        segment.data = static_cast<uint8_t*>(memalloc(segment.size));
+    }
+
+    segment.used = size;
+    return segment.data;
+}
+
+void OScriptFrameStack::pop(void* p_frame)
+{
+    ERR_FAIL_COND(_current >= _segments.size());
+
+    Segment& segment = _segments[_current];
+
+    const uint8_t* frame = static_cast<const uint8_t*>(p_frame);
+    ERR_FAIL_COND_MSG(frame < segment.data || frame >= segment.data + segment.size, "Script frames released out of order");
+
+    segment.used = frame - segment.data;
+
+    // Step back so the next frame is acquired from the previous segment
+    if (segment.used == 0 && _current > 0)
+        _current--;
+}
+
+OScriptFrameStack::~OScriptFrameStack()
+{
+    for (const Segment& segment : _segments)
+        memfree(segment.data);
+}
@@ -0,0 +1,107 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_FRAME_STACK_H
+#define ORCHESTRATOR_SCRIPT_FRAME_STACK_H
+
+#include <godot_cpp/templates/local_vector.hpp>
+
+using namespace godot;
+
+/// A per-thread stack of execution frames for script function calls.
+///
+/// Each function call requires a frame large enough to hold its variant stack, flow stack and other
+/// execution state. Rather than allocating the frame on the native stack, frames are carved from
+/// heap-allocated segments that are reused between calls. When a segment is full, a new segment is
+/// opened, so deep call chains are bounded by available memory rather than the native stack size.
+///
+/// Frames must be released in the reverse order they were acquired. The stack also serves as a scratch
+/// arena for short-lived buffers, which are released together by rewinding to a previously taken mark.
+///
+class OScriptFrameStack
+{
+    /// A contiguous block of frame memory
+    struct Segment
+    {
+        uint8_t* data{ nullptr };  //! The segment's memory
+        uint64_t size{ 0 };        //! The segment's capacity in bytes
+        uint64_t used{ 0 };        //! The number of bytes in use
+    };
+
+    LocalVector<Segment> _segments;  //! Allocated segments, reused between calls
+    uint32_t _current{ 0 };          //! The segment frames are currently acquired from
+
+public:
+    /// A position in the stack, used to release all memory acquired after it
+    struct Mark
+    {
+        uint32_t segment{ 0 };  //! The current segment when the mark was taken
+        uint64_t used{ 0 };     //! The bytes in use in that segment
+    };
+
+private:
+    /// Rewinds to a mark taken in an earlier segment
+    /// @param p_mark the mark
+    void _rewind_segments(const Mark& p_mark);
+
+public:
+
+    /// Alignment of each frame
+    static constexpr uint64_t ALIGNMENT = 16;
+
+    /// Minimum size of each segment
+    static constexpr uint64_t SEGMENT_SIZE = 64 * 1024;
+
+    /// Get the frame stack for the calling thread
+    /// @return the thread's frame stack
+    static OScriptFrameStack& get_thread_stack();
+
+    /// Acquires a frame of the specified size. The memory is not initialized.
+    /// @param p_size the frame size in bytes
+    /// @return the frame's memory
+    void* push(uint64_t p_size);
+
+    /// Releases a frame, which must be the most recently acquired frame
+    /// @param p_frame the frame's memory
+    void pop(void* p_frame);
+
+    /// Get the current position of the stack
+    /// @return the mark
+    _FORCE_INLINE_ Mark get_mark() const
+    {
+        Mark mark;
+        mark.segment = _current;
+        mark.used = _current < _segments.size() ? _segments[_current].used : 0;
+        return mark;
+    }
+
+    /// Releases all memory acquired since the mark was taken, frames acquired since must already be released
+    /// @param p_mark the mark
+    _FORCE_INLINE_ void rewind(const Mark& p_mark)
+    {
+        if (p_mark.segment == _current && _current < _segments.size())
+        {
+            _segments[_current].used = p_mark.used;
+            return;
+        }
+        _rewind_segments(p_mark);
+    }
+
+    /// Destructor
+    ~OScriptFrameStack();
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_FRAME_STACK_H
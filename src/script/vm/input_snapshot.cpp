@@ -0,0 +1,134 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/input_snapshot.h"
+
+#include <godot_cpp/classes/input.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
+
+bool OScriptInputSnapshot::_get_state(int p_index, uint8_t& r_state) const
+{
+    MutexLock lock(*_lock.ptr());
+
+    const LocalVector<uint8_t>& states = _physics ? _physics_states : _idle_states;
+    if (!_valid || p_index < 0 || p_index >= static_cast<int>(states.size()))
+        return false;
+
+    r_state = states[p_index];
+    return true;
+}
+
+void OScriptInputSnapshot::set_enabled(bool p_enabled)
+{
+    MutexLock lock(*_lock.ptr());
+
+    _enabled = p_enabled;
+    if (!_enabled)
+        _valid = false;
+}
+
+int OScriptInputSnapshot::register_action(const StringName& p_action)
+{
+    if (p_action.is_empty())
+        return -1;
+
+    MutexLock lock(*_lock.ptr());
+
+    const HashMap<StringName, int>::ConstIterator E = _action_indices.find(p_action);
+    if (E)
+        return E->value;
+
+    const int index = static_cast<int>(_actions.size());
+    _actions.push_back(p_action);
+    _action_indices[p_action] = index;
+
+    // The new action has no captured state yet, forward queries until the next refresh
+    _valid = false;
+
+    return index;
+}
+
+void OScriptInputSnapshot::invalidate()
+{
+    MutexLock lock(*_lock.ptr());
+    _valid = false;
+}
+
+void OScriptInputSnapshot::refresh(bool p_physics)
+{
+    MutexLock lock(*_lock.ptr());
+
+    _physics = p_physics;
+
+    Input* input = Input::get_singleton();
+    if (!_enabled || !input || _actions.is_empty())
+    {
+        _valid = false;
+        return;
+    }
+
+    LocalVector<uint8_t>& states = p_physics ? _physics_states : _idle_states;
+    states.resize(_actions.size());
+
+    for (uint32_t i = 0; i < _actions.size(); i++)
+    {
+        const StringName& action = _actions[i];
+
+        uint8_t state = 0;
+        if (input->is_action_pressed(action))
+            state |= ACTION_PRESSED;
+        if (input->is_action_just_pressed(action))
+            state |= ACTION_JUST_PRESSED;
+        if (input->is_action_just_released(action))
+            state |= ACTION_JUST_RELEASED;
+
+        states[i] = state;
+    }
+
+    _valid = true;
+}
+
+bool OScriptInputSnapshot::is_action_pressed(int p_index, const StringName& p_action) const
+{
+    uint8_t state;
+    if (_get_state(p_index, state))
+        return state & ACTION_PRESSED;
+
+    return Input::get_singleton()->is_action_pressed(p_action);
+}
+
+bool OScriptInputSnapshot::is_action_just_pressed(int p_index, const StringName& p_action) const
+{
+    uint8_t state;
+    if (_get_state(p_index, state))
+        return state & ACTION_JUST_PRESSED;
+
+    return Input::get_singleton()->is_action_just_pressed(p_action);
+}
+
+bool OScriptInputSnapshot::is_action_just_released(int p_index, const StringName& p_action) const
+{
+    uint8_t state;
+    if (_get_state(p_index, state))
+        return state & ACTION_JUST_RELEASED;
+
+    return Input::get_singleton()->is_action_just_released(p_action);
+}
+
+OScriptInputSnapshot::OScriptInputSnapshot()
+{
+    _lock.instantiate();
+}
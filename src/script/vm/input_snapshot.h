@@ -0,0 +1,111 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_INPUT_SNAPSHOT_H
+#define ORCHESTRATOR_SCRIPT_INPUT_SNAPSHOT_H
+
+#include <godot_cpp/classes/mutex.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using namespace godot;
+
+/// A per-frame cache of the input action states referenced by compiled orchestrations.
+///
+/// Rather than each Input Action node crossing the extension boundary to query the <code>Input</code>
+/// singleton on every step, actions are registered once when the node is instantiated and their
+/// state is captured at the start of each physics and idle frame. Nodes then read the state using
+/// the precomputed action index.
+///
+/// Godot tracks "just pressed" and "just released" separately for physics and idle frames, so two
+/// independent states are captured. Outside of those phases, such as during input event callbacks,
+/// the snapshot is invalid and all queries are forwarded directly to the <code>Input</code> singleton.
+///
+/// Nodes may run on worker threads while the frame callbacks refresh the snapshot, so the captured
+/// states are read and written under the lock.
+///
+class OScriptInputSnapshot
+{
+public:
+    /// Captured state bits for a single action
+    enum ActionState
+    {
+        ACTION_PRESSED = 1 << 0,
+        ACTION_JUST_PRESSED = 1 << 1,
+        ACTION_JUST_RELEASED = 1 << 2
+    };
+
+private:
+    Ref<Mutex> _lock;                          //! Guards action registration and the captured states
+    LocalVector<StringName> _actions;          //! Registered action names, indexed by action index
+    HashMap<StringName, int> _action_indices;  //! Maps action names to action indices
+    LocalVector<uint8_t> _idle_states;         //! Action states captured at the start of the idle frame
+    LocalVector<uint8_t> _physics_states;      //! Action states captured at the start of the physics frame
+    bool _enabled{ true };                     //! Whether the snapshot is used
+    bool _valid{ false };                      //! Whether the snapshot reflects the current frame phase
+    bool _physics{ false };                    //! Whether the current phase is the physics frame
+
+    /// Get the state bits for the specified action index, if the snapshot is valid
+    /// @param p_index the action index
+    /// @param r_state the action state bits
+    /// @return true if the state was resolved from the snapshot, false otherwise
+    bool _get_state(int p_index, uint8_t& r_state) const;
+
+public:
+    /// Set whether the snapshot should be used, when disabled all queries go to the Input singleton.
+    /// @param p_enabled whether the snapshot is enabled
+    void set_enabled(bool p_enabled);
+
+    /// Check whether any actions have been registered
+    /// @return true if there are registered actions, false otherwise
+    bool has_actions() const { return !_actions.is_empty(); }
+
+    /// Registers an action, returning its index in the snapshot
+    /// @param p_action the action name
+    /// @return the action index, or -1 if the action name is empty
+    int register_action(const StringName& p_action);
+
+    /// Captures the state of all registered actions for the current frame phase
+    /// @param p_physics true if called at the start of a physics frame, false for idle frames
+    void refresh(bool p_physics);
+
+    /// Invalidates the snapshot, forwarding queries to the Input singleton until the next refresh
+    void invalidate();
+
+    /// Check whether the action is pressed
+    /// @param p_index the action index
+    /// @param p_action the action name, used when the snapshot is invalid
+    /// @return true if the action is pressed, false otherwise
+    bool is_action_pressed(int p_index, const StringName& p_action) const;
+
+    /// Check whether the action was just pressed
+    /// @param p_index the action index
+    /// @param p_action the action name, used when the snapshot is invalid
+    /// @return true if the action was just pressed, false otherwise
+    bool is_action_just_pressed(int p_index, const StringName& p_action) const;
+
+    /// Check whether the action was just released
+    /// @param p_index the action index
+    /// @param p_action the action name, used when the snapshot is invalid
+    /// @return true if the action was just released, false otherwise
+    bool is_action_just_released(int p_index, const StringName& p_action) const;
+
+    /// Constructor
+    OScriptInputSnapshot();
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_INPUT_SNAPSHOT_H
@@ -0,0 +1,284 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/instance_state.h"
+
+#include "script/serialization/binary_writer.h"
+#include "script/vm/script_vm.h"
+
+#include <godot_cpp/variant/utility_functions.hpp>
+
+namespace
+{
+    const char* MAGIC = "OSIS";
+
+    /// Reads values from an encoded blob, failing once any read exceeds the data
+    struct Reader
+    {
+        const uint8_t* data{ nullptr };
+        uint64_t size{ 0 };
+        uint64_t position{ 0 };
+        bool failed{ false };
+
+        const uint8_t* get_buffer(uint64_t p_size)
+        {
+            if (failed || size - position < p_size)
+            {
+                failed = true;
+                return nullptr;
+            }
+
+            const uint8_t* buffer = data + position;
+            position += p_size;
+            return buffer;
+        }
+
+        uint32_t get_32()
+        {
+            uint32_t value = 0;
+            if (const uint8_t* buffer = get_buffer(sizeof(uint32_t)))
+                memcpy(&value, buffer, sizeof(uint32_t));
+            return value;
+        }
+
+        String get_string()
+        {
+            const uint32_t length = get_32();
+            const uint8_t* buffer = get_buffer(length);
+            return buffer ? String::utf8(reinterpret_cast<const char*>(buffer), length) : String();
+        }
+    };
+
+    /// A variable slot as described by the blob
+    struct EncodedSlot
+    {
+        StringName name;
+        Variant::Type type{ Variant::NIL };
+        bool typed{ false };
+        int offset{ 0 };
+    };
+
+    void store_string(OScriptBinaryWriter& p_writer, const String& p_value)
+    {
+        const CharString utf8 = p_value.utf8();
+        p_writer.store_32(utf8.length());
+        p_writer.store_buffer(reinterpret_cast<const uint8_t*>(utf8.get_data()), utf8.length());
+    }
+
+    bool is_same_layout(const LocalVector<EncodedSlot>& p_slots, int p_typed_size, int p_boxed_count, const Ref<OScriptVariableLayout>& p_layout)
+    {
+        if (p_layout->get_slot_count() != static_cast<int>(p_slots.size()))
+            return false;
+
+        if (p_layout->get_typed_size() != p_typed_size || p_layout->get_boxed_count() != p_boxed_count)
+            return false;
+
+        for (uint32_t i = 0; i < p_slots.size(); i++)
+        {
+            const OScriptVariableLayout::Slot& slot = p_layout->get_slot(static_cast<int>(i));
+            const EncodedSlot& encoded = p_slots[i];
+            if (slot.name != encoded.name || slot.type != encoded.type || slot.typed != encoded.typed || slot.offset != encoded.offset)
+                return false;
+        }
+
+        return true;
+    }
+}
+
+PackedByteArray OScriptInstanceStateCodec::encode(const LocalVector<Pair<String, const OScriptVirtualMachine*>>& p_instances)
+{
+    OScriptBinaryWriter writer;
+    writer.store_buffer(reinterpret_cast<const uint8_t*>(MAGIC), 4);
+    writer.store_32(VERSION);
+    writer.store_32(sizeof(real_t));
+
+    // All instances of a script share the layout of the first instance, others are skipped
+    Ref<OScriptVariableLayout> layout;
+    for (const Pair<String, const OScriptVirtualMachine*>& E : p_instances)
+    {
+        if (E.second->get_variable_layout().is_valid())
+        {
+            layout = E.second->get_variable_layout();
+            break;
+        }
+    }
+
+    const int slot_count = layout.is_valid() ? layout->get_slot_count() : 0;
+    const int typed_size = layout.is_valid() ? layout->get_typed_size() : 0;
+    const int boxed_count = layout.is_valid() ? layout->get_boxed_count() : 0;
+
+    writer.store_32(slot_count);
+    for (int i = 0; i < slot_count; i++)
+    {
+        const OScriptVariableLayout::Slot& slot = layout->get_slot(i);
+        store_string(writer, slot.name);
+        writer.store_32(slot.type);
+        writer.store_8(slot.typed ? 1 : 0);
+        writer.store_32(slot.offset);
+    }
+    writer.store_32(typed_size);
+    writer.store_32(boxed_count);
+
+    // Patched once the records have been written
+    const uint64_t count_position = writer.get_position();
+    writer.store_32(0);
+
+    uint32_t count = 0;
+    for (const Pair<String, const OScriptVirtualMachine*>& E : p_instances)
+    {
+        const OScriptVirtualMachine* vm = E.second;
+        if (vm->get_variable_layout() != layout || E.first.is_empty())
+            continue;
+
+        store_string(writer, E.first);
+
+        if (typed_size > 0)
+            writer.store_buffer(vm->get_typed_variables(), typed_size);
+
+        if (boxed_count > 0)
+        {
+            Array boxed;
+            boxed.resize(boxed_count);
+            for (int i = 0; i < boxed_count; i++)
+                boxed[i] = vm->get_boxed_variables()[i];
+
+            const PackedByteArray bytes = UtilityFunctions::var_to_bytes(boxed);
+            writer.store_32(bytes.size());
+            writer.store_buffer(bytes.ptr(), bytes.size());
+        }
+
+        count++;
+    }
+
+    writer.seek(count_position);
+    writer.store_32(count);
+    writer.seek_end();
+
+    return writer.to_bytes();
+}
+
+Error OScriptInstanceStateCodec::decode(const PackedByteArray& p_data, const HashMap<String, OScriptVirtualMachine*>& p_instances, int& r_restored)
+{
+    r_restored = 0;
+
+    Reader reader;
+    reader.data = p_data.ptr();
+    reader.size = p_data.size();
+
+    const uint8_t* magic = reader.get_buffer(4);
+    ERR_FAIL_COND_V_MSG(!magic || memcmp(magic, MAGIC, 4) != 0, ERR_FILE_UNRECOGNIZED, "Not an instance state blob");
+    ERR_FAIL_COND_V_MSG(reader.get_32() != VERSION, ERR_FILE_UNRECOGNIZED, "Unsupported instance state version");
+    ERR_FAIL_COND_V_MSG(reader.get_32() != sizeof(real_t), ERR_FILE_UNRECOGNIZED, "Instance state was encoded with a different real_t precision");
+
+    LocalVector<EncodedSlot> slots;
+    const uint32_t slot_count = reader.get_32();
+    for (uint32_t i = 0; i < slot_count && !reader.failed; i++)
+    {
+        EncodedSlot slot;
+        slot.name = reader.get_string();
+        slot.type = static_cast<Variant::Type>(reader.get_32());
+        slot.typed = reader.get_buffer(1) && reader.data[reader.position - 1] != 0;
+        slot.offset = static_cast<int>(reader.get_32());
+        slots.push_back(slot);
+    }
+
+    const int typed_size = static_cast<int>(reader.get_32());
+    const int boxed_count = static_cast<int>(reader.get_32());
+    const uint32_t count = reader.get_32();
+    ERR_FAIL_COND_V_MSG(reader.failed, ERR_FILE_CORRUPT, "Instance state blob is truncated");
+
+    // Validate slot offsets so reads by name stay within the record
+    for (const EncodedSlot& slot : slots)
+    {
+        const int limit = slot.typed ? typed_size - OScriptVariableLayout::get_typed_size(slot.type) : boxed_count - 1;
+        ERR_FAIL_COND_V_MSG(slot.offset < 0 || slot.offset > limit, ERR_FILE_CORRUPT, "Instance state blob has an invalid layout");
+    }
+
+    // The mapping to the instance's layout is resolved once for each distinct layout
+    Ref<OScriptVariableLayout> mapped_layout;
+    bool same_layout = false;
+    LocalVector<int> slot_indices;
+
+    for (uint32_t r = 0; r < count; r++)
+    {
+        const String name = reader.get_string();
+        const uint8_t* typed = reader.get_buffer(typed_size);
+
+        Array boxed;
+        if (boxed_count > 0)
+        {
+            const uint32_t length = reader.get_32();
+            const uint64_t position = reader.position;
+            if (reader.get_buffer(length))
+                boxed = UtilityFunctions::bytes_to_var(p_data.slice(position, position + length));
+        }
+
+        ERR_FAIL_COND_V_MSG(reader.failed, ERR_FILE_CORRUPT, "Instance state blob is truncated");
+        ERR_FAIL_COND_V_MSG(boxed.size() != boxed_count, ERR_FILE_CORRUPT, "Instance state blob has invalid values");
+
+        const HashMap<String, OScriptVirtualMachine*>::ConstIterator E = p_instances.find(name);
+        if (!E)
+            continue;
+
+        OScriptVirtualMachine* vm = E->value;
+        const Ref<OScriptVariableLayout> layout = vm->get_variable_layout();
+        if (!layout.is_valid())
+            continue;
+
+        if (layout != mapped_layout)
+        {
+            mapped_layout = layout;
+            same_layout = is_same_layout(slots, typed_size, boxed_count, layout);
+
+            slot_indices.resize(slots.size());
+            for (uint32_t i = 0; i < slots.size(); i++)
+            {
+                const int index = layout->find_slot(slots[i].name);
+                slot_indices[i] = index != -1 && layout->get_slot(index).type == slots[i].type ? index : -1;
+            }
+        }
+
+        if (same_layout)
+        {
+            // Bulk copy the unboxed storage, only boxed values are assigned individually
+            if (typed_size > 0)
+                memcpy(vm->get_typed_variables(), typed, typed_size);
+
+            for (int i = 0; i < boxed_count; i++)
+                vm->get_boxed_variables()[i] = boxed[i];
+        }
+        else
+        {
+            for (uint32_t i = 0; i < slots.size(); i++)
+            {
+                if (slot_indices[i] == -1)
+                    continue;
+
+                Variant value;
+                if (slots[i].typed)
+                    OScriptVariableLayout::read(slots[i].type, typed + slots[i].offset, value);
+                else
+                    value = boxed[slots[i].offset];
+
+                vm->set_variable_value(slot_indices[i], value);
+            }
+        }
+
+        r_restored++;
+    }
+
+    return OK;
+}
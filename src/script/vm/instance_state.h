@@ -0,0 +1,62 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_INSTANCE_STATE_H
+#define ORCHESTRATOR_SCRIPT_INSTANCE_STATE_H
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/pair.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+/// Forward declarations
+class OScriptVirtualMachine;
+
+/// Encodes the variable values of many script instances into a single compact blob.
+///
+/// The blob begins with a description of the variable layout, followed by a record per instance
+/// keyed by a caller supplied name, such as the owner's node path. Each record holds the unboxed
+/// variable storage as a single block followed by the boxed values. When the blob is restored to
+/// instances with the same layout, the unboxed block is copied directly; otherwise variables are
+/// matched by name and type.
+///
+/// Boxed values are encoded with <code>var_to_bytes</code>, so objects are not preserved. The blob
+/// is intended for checkpoints within the same build, and is rejected by builds with a different
+/// <code>real_t</code> precision.
+///
+class OScriptInstanceStateCodec
+{
+public:
+    /// The blob format version
+    static constexpr uint32_t VERSION = 1;
+
+    /// Encodes the variables of each instance
+    /// @param p_instances the instances, keyed by name
+    /// @return the encoded blob
+    static PackedByteArray encode(const LocalVector<Pair<String, const OScriptVirtualMachine*>>& p_instances);
+
+    /// Decodes the blob, applying each record to the instance with the matching name
+    /// @param p_data the encoded blob
+    /// @param p_instances the instances, keyed by name
+    /// @param r_restored the number of instances restored
+    /// @return the error code, <code>OK</code> if successful
+    static Error decode(const PackedByteArray& p_data, const HashMap<String, OScriptVirtualMachine*>& p_instances, int& r_restored);
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_INSTANCE_STATE_H
@@ -0,0 +1,129 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/node_profiler.h"
+
+#include "script/vm/script_vm.h"
+
+#include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
+
+void OScriptNodeProfiler::_bind_methods()
+{
+    ClassDB::bind_method(D_METHOD("set_enabled", "enabled"), &OScriptNodeProfiler::set_enabled);
+    ClassDB::bind_method(D_METHOD("is_enabled"), &OScriptNodeProfiler::is_enabled);
+    ClassDB::bind_method(D_METHOD("get_snapshot"), &OScriptNodeProfiler::get_snapshot);
+}
+
+void OScriptNodeProfiler::_collect(HashMap<String, NodeSamples>& r_samples) const
+{
+    r_samples = _retired;
+
+    for (const OScriptVirtualMachine* machine : _machines)
+        machine->collect_node_samples(r_samples[machine->get_script_path()]);
+}
+
+void OScriptNodeProfiler::_toggle(bool p_enable, const Array& p_options)
+{
+    set_enabled(p_enable);
+}
+
+void OScriptNodeProfiler::_tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time)
+{
+    if (!is_enabled())
+        return;
+
+    _elapsed += p_frame_time;
+    if (_elapsed < _interval)
+        return;
+
+    _elapsed = 0;
+
+    EngineDebugger* debugger = EngineDebugger::get_singleton();
+    if (debugger && debugger->is_active())
+        debugger->send_message(SNAPSHOT_MESSAGE, get_snapshot());
+}
+
+void OScriptNodeProfiler::set_enabled(bool p_enabled)
+{
+    MutexLock lock(*_lock.ptr());
+    if (is_enabled() == p_enabled)
+        return;
+
+    if (p_enabled)
+    {
+        // Machines compare their session on the next sample, and discard stale counts
+        _session.fetch_add(1, std::memory_order_relaxed);
+        _machines.clear();
+        _retired.clear();
+        _elapsed = 0;
+    }
+
+    _enabled.store(p_enabled, std::memory_order_relaxed);
+}
+
+uint32_t OScriptNodeProfiler::register_machine(OScriptVirtualMachine* p_machine)
+{
+    MutexLock lock(*_lock.ptr());
+    _machines.insert(p_machine);
+    return get_session();
+}
+
+void OScriptNodeProfiler::unregister_machine(OScriptVirtualMachine* p_machine, uint32_t p_session)
+{
+    MutexLock lock(*_lock.ptr());
+    if (p_session != get_session() || !_machines.has(p_machine))
+        return;
+
+    p_machine->collect_node_samples(_retired[p_machine->get_script_path()]);
+    _machines.erase(p_machine);
+}
+
+Array OScriptNodeProfiler::get_snapshot() const
+{
+    HashMap<String, NodeSamples> samples;
+    {
+        MutexLock lock(*_lock.ptr());
+        _collect(samples);
+    }
+
+    Array snapshot;
+    for (const KeyValue<String, NodeSamples>& E : samples)
+    {
+        PackedInt32Array ids;
+        PackedInt64Array counts;
+        PackedInt64Array usecs;
+        for (const KeyValue<int, Sample>& S : E.value)
+        {
+            if (S.value.count == 0)
+                continue;
+
+            ids.push_back(S.key);
+            counts.push_back(static_cast<int64_t>(S.value.count));
+            usecs.push_back(static_cast<int64_t>(S.value.usec));
+        }
+
+        if (!ids.is_empty())
+            snapshot.push_back(Array::make(E.key, ids, counts, usecs));
+    }
+
+    return snapshot;
+}
+
+OScriptNodeProfiler::OScriptNodeProfiler()
+{
+    _lock.instantiate();
+}
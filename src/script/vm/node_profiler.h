@@ -0,0 +1,118 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_NODE_PROFILER_H
+#define ORCHESTRATOR_SCRIPT_NODE_PROFILER_H
+
+#include <godot_cpp/classes/engine_profiler.hpp>
+#include <godot_cpp/classes/mutex.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/variant/array.hpp>
+
+#include <atomic>
+
+using namespace godot;
+
+/// Forward declarations
+class OScriptVirtualMachine;
+
+/// Collects per-node execution counts and cumulative time, used for the graph editor heatmap.
+///
+/// Samples are taken by each virtual machine only while the profiler is enabled. Each machine counts
+/// into its own node instances, and registers with the profiler when it takes its first sample, so
+/// that executing a node never takes a lock. A snapshot sums the samples of all registered machines
+/// by script and node, including machines that have since been destroyed.
+///
+/// Machines may execute on worker threads while a snapshot is taken on the main thread, so the
+/// counters, the enabled flag and the session are relaxed atomics. A snapshot may observe a count
+/// without its matching time, which is acceptable for a heatmap.
+///
+/// The profiler is registered with the engine debugger, and is toggled by the editor's debugger
+/// plugin. While enabled, a snapshot is sent to the editor periodically.
+///
+class OScriptNodeProfiler : public EngineProfiler
+{
+    GDCLASS(OScriptNodeProfiler, EngineProfiler);
+    static void _bind_methods();
+
+public:
+    /// The name the profiler is registered with in the engine debugger
+    static constexpr const char* PROFILER_NAME = "orchestrator_heatmap";
+
+    /// The debugger message that carries snapshots
+    static constexpr const char* SNAPSHOT_MESSAGE = "orchestrator:heatmap";
+
+    /// Execution statistics for a single node
+    struct Sample
+    {
+        uint64_t count{ 0 };  //! Number of times the node executed
+        uint64_t usec{ 0 };   //! Cumulative execution time, including nested calls
+    };
+
+    typedef HashMap<int, Sample> NodeSamples;
+
+private:
+    Ref<Mutex> _lock;                                //! Guards the registered machines and retired samples
+    std::atomic<bool> _enabled{ false };             //! Whether machines should take samples
+    std::atomic<uint32_t> _session{ 0 };             //! Incremented each time profiling is enabled
+    HashSet<OScriptVirtualMachine*> _machines;       //! Machines that sampled in the current session
+    HashMap<String, NodeSamples> _retired;           //! Samples of destroyed machines, by script path
+    double _elapsed{ 0 };                            //! Seconds since the last snapshot was sent
+    double _interval{ 0.5 };                         //! Seconds between snapshots
+
+    /// Sums the samples of all machines, by script path
+    /// @param r_samples the samples
+    void _collect(HashMap<String, NodeSamples>& r_samples) const;
+
+public:
+    //~ Begin EngineProfiler Interface
+    void _toggle(bool p_enable, const Array& p_options) override;
+    void _tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override;
+    //~ End EngineProfiler Interface
+
+    /// Check whether machines should take samples
+    /// @return true if enabled, false otherwise
+    _FORCE_INLINE_ bool is_enabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    /// Get the current session, machines holding samples from an older session must discard them
+    /// @return the session
+    _FORCE_INLINE_ uint32_t get_session() const { return _session.load(std::memory_order_relaxed); }
+
+    /// Enables or disables sampling, enabling starts a new session and discards previous samples
+    /// @param p_enabled whether to enable sampling
+    void set_enabled(bool p_enabled);
+
+    /// Registers a machine that started sampling
+    /// @param p_machine the machine
+    /// @return the session the machine is registered with
+    uint32_t register_machine(OScriptVirtualMachine* p_machine);
+
+    /// Unregisters a machine that is being destroyed, retaining its samples
+    /// @param p_machine the machine
+    /// @param p_session the session the machine registered with
+    void unregister_machine(OScriptVirtualMachine* p_machine, uint32_t p_session);
+
+    /// Get the samples taken in the current session. Each entry is an array of the script path,
+    /// followed by packed arrays of node ids, execution counts, and cumulative times in microseconds.
+    /// @return the snapshot
+    Array get_snapshot() const;
+
+    /// Constructor
+    OScriptNodeProfiler();
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_NODE_PROFILER_H
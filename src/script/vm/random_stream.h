@@ -0,0 +1,148 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_RANDOM_STREAM_H
+#define ORCHESTRATOR_SCRIPT_RANDOM_STREAM_H
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <cstdint>
+
+/// A small, inlined PCG32 random number generator used by the runtime.
+///
+/// Each stream is defined by a seed and a stream selector, and two streams with different selectors
+/// produce independent sequences even when seeded identically. This allows a root stream to be split
+/// into child streams, i.e. one per script instance, so that results remain reproducible for a given
+/// seed regardless of how many other streams draw values.
+///
+class OScriptRandomStream
+{
+    static constexpr uint64_t MULTIPLIER = 6364136223846793005ULL;
+
+    uint64_t _state{ 0x853c49e6748fea9bULL };  //! Generator state
+    uint64_t _inc{ 0xda3e39cb94b95bdbULL };    //! Stream selector, always odd
+
+public:
+    /// Seeds the stream
+    /// @param p_seed the seed
+    /// @param p_stream the stream selector
+    void seed(uint64_t p_seed, uint64_t p_stream = 0)
+    {
+        _state = 0;
+        _inc = (p_stream << 1) | 1;
+        next();
+        _state += p_seed;
+        next();
+    }
+
+    /// Get the next 32-bit random value
+    /// @return the random value
+    _FORCE_INLINE_ uint32_t next()
+    {
+        const uint64_t old_state = _state;
+        _state = old_state * MULTIPLIER + _inc;
+        const uint32_t xor_shifted = static_cast<uint32_t>(((old_state >> 18) ^ old_state) >> 27);
+        const uint32_t rot = static_cast<uint32_t>(old_state >> 59);
+        return (xor_shifted >> rot) | (xor_shifted << ((-rot) & 31));
+    }
+
+    /// Get the next 64-bit random value
+    /// @return the random value
+    _FORCE_INLINE_ uint64_t next64()
+    {
+        return (static_cast<uint64_t>(next()) << 32) | next();
+    }
+
+    /// Get an unbiased random value in the range [0, p_bound)
+    /// @param p_bound the exclusive upper bound, must be greater than 0
+    /// @return the random value
+    _FORCE_INLINE_ uint32_t bounded(uint32_t p_bound)
+    {
+        // Lemire's nearly divisionless method
+        uint64_t m = static_cast<uint64_t>(next()) * p_bound;
+        uint32_t l = static_cast<uint32_t>(m);
+        if (l < p_bound)
+        {
+            const uint32_t threshold = (0u - p_bound) % p_bound;
+            while (l < threshold)
+            {
+                m = static_cast<uint64_t>(next()) * p_bound;
+                l = static_cast<uint32_t>(m);
+            }
+        }
+        return static_cast<uint32_t>(m >> 32);
+    }
+
+    /// Get a random integer in the inclusive range [p_from, p_to]
+    /// @param p_from the minimum value
+    /// @param p_to the maximum value
+    /// @return the random value
+    _FORCE_INLINE_ int range(int p_from, int p_to)
+    {
+        if (p_to <= p_from)
+            return p_from;
+
+        const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(p_to) - p_from) + 1;
+        if (span > UINT32_MAX)
+            return static_cast<int>(p_from + static_cast<int64_t>(next()));
+
+        return static_cast<int>(p_from + static_cast<int64_t>(bounded(static_cast<uint32_t>(span))));
+    }
+
+    /// Get a random float in the range [0, 1)
+    /// @return the random value
+    _FORCE_INLINE_ float randf()
+    {
+        return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /// Get a random double in the range [0, 1)
+    /// @return the random value
+    _FORCE_INLINE_ double randd()
+    {
+        return static_cast<double>(next64() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /// Get the generator state, used to save and restore the stream
+    /// @return the generator state
+    _FORCE_INLINE_ uint64_t get_state() const { return _state; }
+
+    /// Get the stream selector, used to save and restore the stream
+    /// @return the stream selector
+    _FORCE_INLINE_ uint64_t get_increment() const { return _inc; }
+
+    /// Restores the stream to a previously saved state
+    /// @param p_state the generator state
+    /// @param p_increment the stream selector
+    void restore(uint64_t p_state, uint64_t p_increment)
+    {
+        _state = p_state;
+        _inc = p_increment | 1;
+    }
+
+    /// Splits off an independent child stream, advancing this stream.
+    /// @return the child stream
+    OScriptRandomStream split()
+    {
+        OScriptRandomStream child;
+        const uint64_t seed = next64();
+        const uint64_t stream = next64();
+        child.seed(seed, stream);
+        return child;
+    }
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_RANDOM_STREAM_H
@@ -54,8 +54,11 @@ Variant OScriptState::_call_method(GDExtensionCallError& r_error)
     OScriptExecutionContext context(_stack_info, stack, _flow_stack_pos, _pass);
     context._script_instance = _script_instance;
 
+    // Resumed execution is driven by the awaited signal, which is not recorded
     Variant result;
+    _instance->_record_pause++;
     _instance->_call_method_internal(_function, &context, true, _node, _func_ptr, result, r_error);
+    _instance->_record_pause--;
 
     _function = StringName();
 
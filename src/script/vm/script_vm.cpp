@@ -16,13 +16,20 @@
 //
 #include "script/vm/script_vm.h"
 
+#include "common/method_utils.h"
 #include "common/settings.h"
+#include "common/variant_utils.h"
 #include "orchestration/orchestration.h"
 #include "script/instances/node_instance.h"
+#include "script/nodes/functions/call_script_function.h"
+#include "script/nodes/functions/function_result.h"
 #include "script/nodes/variables/local_variable.h"
+#include "script/vm/execution_context.h"
+#include "script/vm/frame_stack.h"
 #include "script/vm/script_state.h"
 
 #include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/time.hpp>
 
 static int get_exec_pin_index_of_port(const Ref<OScriptNode>& p_node, int p_port, EPinDirection p_direction)
 {
@@ -248,13 +255,50 @@ bool OScriptVirtualMachine::_create_node_instance_pins(const Ref<OScriptNode>& p
     return true;
 }
 
-bool OScriptVirtualMachine::_create_node_instance(Orchestration* p_orchestration, int p_node_id, Function& r_function, HashMap<String, int>& r_lv_indices)
+void OScriptVirtualMachine::_infer_input_types(Orchestration* p_orchestration, const Ref<OScriptNode>& p_node, const HashMap<int, HashMap<int, Pair<int, int>>>& p_lookup, Vector<Variant::Type>& r_types)
+{
+    const HashMap<int, HashMap<int, Pair<int, int>>>::ConstIterator C = p_lookup.find(p_node->get_id());
+
+    int data_index = 0;
+    for (const Ref<OScriptNodePin>& pin : p_node->find_pins(PD_Input))
+    {
+        if (pin->is_execution())
+            continue;
+
+        Variant::Type type = Variant::NIL;
+        const HashMap<int, Pair<int, int>>::ConstIterator S = C ? C->value.find(data_index) : HashMap<int, Pair<int, int>>::ConstIterator();
+        if (S)
+        {
+            // Connected inputs receive values from the source output pin's declared type
+            const Ref<OScriptNode> source = p_orchestration->get_node(S->value.first);
+            if (source.is_valid())
+            {
+                const Ref<OScriptNodePin> source_pin = get_data_pin_at_count_index(source, S->value.second, PD_Output);
+                if (source_pin.is_valid())
+                    type = source_pin->get_type();
+            }
+        }
+        else
+        {
+            // Unconnected inputs receive the pin's literal default value
+            type = pin->get_effective_default_value().get_type();
+        }
+
+        r_types.push_back(type);
+        data_index++;
+    }
+}
+
+bool OScriptVirtualMachine::_create_node_instance(Orchestration* p_orchestration, int p_node_id, Function& r_function, HashMap<String, int>& r_lv_indices, const HashMap<int, HashMap<int, Pair<int, int>>>& p_lookup)
 {
     const Ref<OScriptNode>& node = p_orchestration->get_node(p_node_id);
     if (!node.is_valid())
         return false;
 
-    OScriptNodeInstance* instance = node->instantiate();
+    Vector<Variant::Type> input_types;
+    _infer_input_types(p_orchestration, node, p_lookup, input_types);
+
+    OScriptNodeInstance* instance = node->instantiate_specialized(input_types);
     ERR_FAIL_COND_V_MSG(!instance, false, "Failed to create node instance for node ID " + itos(p_node_id));
 
     instance->_base = node.ptr();
@@ -348,7 +392,7 @@ bool OScriptVirtualMachine::_build_function_node_graph(const Ref<OScriptFunction
     // Iterate the execution path and construct the node instances
     for (const int E : execution_path)
     {
-        if (!_create_node_instance(p_function->get_orchestration(), E, r_function, r_lv_indices))
+        if (!_create_node_instance(p_function->get_orchestration(), E, r_function, r_lv_indices, data_conn_lookup))
         {
             OScriptLanguage::get_singleton()->debug_break_parse(
                 p_function->get_orchestration()->get_self()->get_path(),
@@ -432,6 +476,27 @@ bool OScriptVirtualMachine::_build_function_node_graph(const Ref<OScriptFunction
         _set_unassigned_outputs(node, instance, r_function.trash_pos);
     }
 
+    // Step 5
+    // Mark script function calls whose return value is immediately returned by the function.
+    // These calls hand their arguments back to the caller's frame rather than nesting a call.
+    for (const int E : execution_path)
+    {
+        OScriptNodeInstance* instance = _nodes[E];
+
+        OScriptNodeCallScriptFunction* call = Object::cast_to<OScriptNodeCallScriptFunction>(instance->_base);
+        if (!call || !MethodUtils::has_return_value(call->get_method_info()))
+            continue;
+
+        if (instance->execution_output_pin_count != 1 || instance->output_pin_count == 0)
+            continue;
+
+        const OScriptNodeInstance* next = instance->execution_outputs[0];
+        if (!next || !Object::cast_to<OScriptNodeFunctionResult>(next->_base) || next->input_pin_count == 0)
+            continue;
+
+        instance->tail_call = next->input_pins[0] == instance->output_pins[0];
+    }
+
     return true;
 }
 
@@ -557,9 +622,9 @@ int OScriptVirtualMachine::_execute_step(OScriptExecutionContext& p_context, OSc
     p_context._set_current_node_working_memory(p_instance->get_working_memory_size());
 
     #if GODOT_VERSION >= 0x040300
-    EngineDebugger* debugger = EngineDebugger::get_singleton();
-    if (debugger && debugger->is_active())
+    if (_debugging)
     {
+        EngineDebugger* debugger = EngineDebugger::get_singleton();
         Orchestration* orchestration = p_instance->get_base_node()->get_orchestration();
 
         bool do_break = false;
@@ -586,8 +651,90 @@ int OScriptVirtualMachine::_execute_step(OScriptExecutionContext& p_context, OSc
     // Reset node
     p_context._current_node_id = current_node_id;
 
-    // Execute
-    return p_instance->step(p_context);
+    // Scratch memory acquired by the step is released once it completes
+    const OScriptFrameStack::Mark mark = p_context._frames->get_mark();
+
+    // Execute, nodes that read external state are substituted by a replay and recorded otherwise
+    int result;
+    if (unlikely(_replay) && p_instance->is_external_input())
+        result = _replay_step(p_context, p_instance);
+    else
+    {
+        result = unlikely(_profiler && _profiler->is_enabled())
+            ? _execute_profiled_step(p_context, p_instance)
+            : p_instance->step(p_context);
+
+        if (unlikely(is_recording()) && p_instance->is_external_input())
+            _record_step(p_context, p_instance, result);
+    }
+
+    p_context._frames->rewind(mark);
+
+    return result;
+}
+
+int OScriptVirtualMachine::_execute_profiled_step(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance)
+{
+    // Samples from an earlier session are discarded when sampling resumes
+    if (_profile_session != _profiler->get_session())
+    {
+        for (const KeyValue<int, OScriptNodeInstance*>& E : _nodes)
+        {
+            E.value->profile_count.store(0, std::memory_order_relaxed);
+            E.value->profile_usec.store(0, std::memory_order_relaxed);
+        }
+        _profile_session = _profiler->register_machine(this);
+    }
+
+    Time* time = Time::get_singleton();
+    const uint64_t start = time->get_ticks_usec();
+
+    const int result = p_instance->step(p_context);
+
+    p_instance->profile_count.fetch_add(1, std::memory_order_relaxed);
+    p_instance->profile_usec.fetch_add(time->get_ticks_usec() - start, std::memory_order_relaxed);
+
+    return result;
+}
+
+void OScriptVirtualMachine::_record_step(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance, int p_result)
+{
+    // A failed step is reported again when replayed
+    if (p_context.has_error())
+        return;
+
+    Array values;
+    values.resize(p_instance->data_output_pin_count + 2);
+    values[0] = p_instance->id;
+    values[1] = p_result;
+    for (int i = 0; i < p_instance->data_output_pin_count; i++)
+        values[i + 2] = p_context.get_output(i);
+
+    _recorder->record_step(_record_track, values);
+}
+
+int OScriptVirtualMachine::_replay_step(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance)
+{
+    // Callbacks into this instance that were recorded before the step
+    Variant call_return;
+    GDExtensionCallError call_err;
+    while (replay_call(p_context.get_script_instance(), call_return, call_err))
+        call_return.clear();
+
+    const OScriptExecutionRecorder::Track* track = _replay->track;
+    if (!_replay->has_next(OScriptExecutionRecorder::EVENT_STEP)
+        || static_cast<int>(track->events[_replay->position].values[0]) != p_instance->id)
+    {
+        _replay->divergences++;
+        p_context.set_error(vformat("Replay diverged from the recording, no outputs were recorded for node %d.", p_instance->id));
+        return -1 | OScriptNodeInstance::STEP_FLAG_END;
+    }
+
+    const Array& values = track->events[_replay->position++].values;
+    for (int i = 0; i < p_instance->data_output_pin_count && i + 2 < values.size(); i++)
+        p_context.set_output(i, values[i + 2]);
+
+    return values[1];
 }
 
 OScriptNodeInstance* OScriptVirtualMachine::_resolve_next_node(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance, int p_result, int p_next_node_id)
@@ -631,6 +778,17 @@ void OScriptVirtualMachine::_set_node_flow_execution_state(OScriptExecutionConte
 
 void OScriptVirtualMachine::_report_error(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance, const StringName& p_method)
 {
+    OScriptErrorReporter::ErrorKey key;
+    key.script = _script.ptr();
+    key.function = p_method;
+    key.node = p_context.get_current_node();
+    key.kind = p_context.get_error().error;
+
+    // Repeated errors are only counted, and summarized periodically by the language
+    OScriptErrorReporter* reporter = OScriptLanguage::get_singleton()->get_error_reporter();
+    if (!reporter->should_report(key))
+        return;
+
     const String err_file = _script->get_path();
     const String err_func = p_method;
     const int err_line = p_context.get_current_node();
@@ -678,6 +836,8 @@ void OScriptVirtualMachine::_report_error(OScriptExecutionContext& p_context, OS
         }
     }
 
+    reporter->reported(key, err_file, err_line, error_str);
+
     if (!OScriptLanguage::get_singleton()->debug_break(error_str, false))
         _err_print_error(err_func.utf8().get_data(), err_file.utf8().get_data(), err_line, error_str.utf8().get_data());
 }
@@ -697,7 +857,7 @@ void OScriptVirtualMachine::_call_method_internal(const StringName& p_method, OS
     int node_port = 0; // always assumes 0 for now
 
     #if GODOT_VERSION >= 0x040300
-    if (EngineDebugger::get_singleton()->is_active())
+    if (_debugging)
         OScriptLanguage::get_singleton()->function_entry(&p_method, p_context);
     #endif
 
@@ -782,13 +942,17 @@ void OScriptVirtualMachine::_call_method_internal(const StringName& p_method, OS
             r_return = state;
 
             #if GODOT_VERSION >= 0x040300
-            if (EngineDebugger::get_singleton()->is_active())
+            if (_debugging)
                 OScriptLanguage::get_singleton()->function_exit(&p_method, p_context);
             #endif
 
             return;
         }
 
+        // The function returns the result of another call, which reuses this frame
+        if (result & OScriptNodeInstance::STEP_FLAG_TAIL_CALL)
+            break;
+
         // Check whether the function exited or ended
         if (result & OScriptNodeInstance::STEP_FLAG_END)
         {
@@ -800,7 +964,7 @@ void OScriptVirtualMachine::_call_method_internal(const StringName& p_method, OS
         }
 
         #if GODOT_VERSION >= 0x040300
-        if (EngineDebugger::get_singleton()->is_active())
+        if (_debugging)
         {
             bool do_break = false;
 
@@ -925,7 +1089,7 @@ void OScriptVirtualMachine::_call_method_internal(const StringName& p_method, OS
         _report_error(context, node, p_method);
 
     #if GODOT_VERSION >= 0x040300
-    if (EngineDebugger::get_singleton()->is_active())
+    if (_debugging)
         OScriptLanguage::get_singleton()->function_exit(&p_method, p_context);
     #endif
 
@@ -933,52 +1097,82 @@ void OScriptVirtualMachine::_call_method_internal(const StringName& p_method, OS
     context._cleanup();
 }
 
-bool OScriptVirtualMachine::register_variable(const Ref<OScriptVariable>& p_variable)
+bool OScriptVirtualMachine::initialize_variables(const Ref<OScriptVariableLayout>& p_layout, uint8_t* p_typed_storage)
 {
-    ERR_FAIL_COND_V_MSG(!p_variable.is_valid(), false, "Cannot register a variable that is invalid");
-    ERR_FAIL_COND_V_MSG(_variables.has(p_variable->get_variable_name()), false, "A variable is defined with the name: " + p_variable->get_variable_name());
+    ERR_FAIL_COND_V_MSG(!p_layout.is_valid(), false, "Cannot initialize variables without a layout");
+    ERR_FAIL_COND_V_MSG(_variable_layout.is_valid(), false, "Variables are already initialized");
+
+    _variable_layout = p_layout;
 
-    Variable variable;
-    variable.exported = p_variable->is_exported();
-    variable.value= p_variable->get_default_value();
-    variable.type = p_variable->get_variable_type();
+    if (p_layout->get_typed_size() > 0)
+    {
+        if (p_typed_storage)
+        {
+            _typed_variables = p_typed_storage;
+        }
+        else
+        {
+            // Over-allocate so that the storage block can be aligned
+            const int alignment = OScriptVariableLayout::ALIGNMENT;
+            _typed_variables_alloc = memalloc(p_layout->get_typed_size() + alignment);
+            _typed_variables = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(_typed_variables_alloc) + alignment - 1) & ~uintptr_t(alignment - 1));
+        }
 
-    _variables[p_variable->get_variable_name()] = variable;
+        // Unboxed values are trivially copyable, so the defaults are copied as a single block
+        memcpy(_typed_variables, p_layout->get_typed_defaults(), p_layout->get_typed_size());
+    }
+
+    if (p_layout->get_boxed_count() > 0)
+    {
+        _boxed_variables = memnew_arr(Variant, p_layout->get_boxed_count());
+        for (int i = 0; i < p_layout->get_boxed_count(); i++)
+            _boxed_variables[i] = p_layout->get_boxed_default(i);
+    }
 
     return true;
 }
 
+void OScriptVirtualMachine::collect_node_samples(OScriptNodeProfiler::NodeSamples& r_samples) const
+{
+    for (const KeyValue<int, OScriptNodeInstance*>& E : _nodes)
+    {
+        const uint64_t count = E.value->profile_count.load(std::memory_order_relaxed);
+        if (count == 0)
+            continue;
+
+        OScriptNodeProfiler::Sample& sample = r_samples[E.key];
+        sample.count += count;
+        sample.usec += E.value->profile_usec.load(std::memory_order_relaxed);
+    }
+}
+
 bool OScriptVirtualMachine::has_variable(const StringName& p_name) const
 {
-    return _variables.has(p_name);
+    return get_variable_index(p_name) != -1;
 }
 
-OScriptVirtualMachine::Variable* OScriptVirtualMachine::get_variable(const StringName& p_name) const
+int OScriptVirtualMachine::get_variable_index(const StringName& p_name) const
 {
-    const HashMap<StringName, Variable>::ConstIterator E = _variables.find(p_name);
-    return E ? const_cast<Variable*>(&E->value) : nullptr;
+    return _variable_layout.is_valid() ? _variable_layout->find_slot(p_name) : -1;
 }
 
 bool OScriptVirtualMachine::get_variable(const StringName& p_name, Variant& r_value) const
 {
-    if (!_variables.has(p_name))
+    const int index = get_variable_index(p_name);
+    if (index == -1)
         return false;
 
-    const Variable& variable = _variables[p_name];
-    r_value = variable.value;
-
+    get_variable_value(index, r_value);
     return true;
 }
 
 bool OScriptVirtualMachine::set_variable(const StringName& p_name, const Variant& p_value)
 {
-    if (!_variables.has(p_name))
+    const int index = get_variable_index(p_name);
+    if (index == -1)
         return false;
 
-    Variable& variable = _variables[p_name];
-    variable.value = p_value;
-
-    return true;
+    return set_variable_value(index, p_value);
 }
 
 bool OScriptVirtualMachine::has_signal(const StringName& p_name) const
@@ -1002,6 +1196,16 @@ bool OScriptVirtualMachine::register_function(const Ref<OScriptFunction>& p_func
     function.max_stack = function.argument_count;
     function.flow_stack_size = 256;
 
+    const MethodInfo& method = p_function->get_method_info();
+    for (const PropertyInfo& argument : method.arguments)
+    {
+        function.argument_types.push_back(argument.type);
+        function.argument_names.push_back(argument.name);
+    }
+    function.required_argument_count = MAX(0, function.argument_count - static_cast<int>(method.default_arguments.size()));
+    for (const Variant& value : method.default_arguments)
+        function.default_arguments.push_back(value);
+
     if (function.node < 0)
     {
         OScriptLanguage::get_singleton()->debug_break_parse(
@@ -1033,11 +1237,212 @@ bool OScriptVirtualMachine::register_function(const Ref<OScriptFunction>& p_func
     return true;
 }
 
-void OScriptVirtualMachine::call_method(OScriptInstance* p_instance, const StringName& p_method, const Variant* const* p_args, GDExtensionInt p_arg_count, Variant* r_return, GDExtensionCallError* r_err)
+bool OScriptVirtualMachine::_check_argument_count(const Function& p_function, const StringName& p_method, int p_arg_count, GDExtensionCallError* r_err)
 {
-    ERR_FAIL_COND_MSG(!r_err, "No error code argument provided.");
+    if (p_arg_count > p_function.argument_count)
+    {
+        r_err->error = GDEXTENSION_CALL_ERROR_TOO_MANY_ARGUMENTS;
+        r_err->expected = p_function.argument_count;
+        ERR_PRINT(vformat("Too many arguments for function '%s': expected %d but received %d.", p_method, p_function.argument_count, p_arg_count));
+        return false;
+    }
 
-    r_err->error = GDEXTENSION_CALL_OK;
+    if (p_arg_count < p_function.required_argument_count)
+    {
+        r_err->error = GDEXTENSION_CALL_ERROR_TOO_FEW_ARGUMENTS;
+        r_err->expected = p_function.required_argument_count;
+        ERR_PRINT(vformat("Too few arguments for function '%s': expected %d but received %d.", p_method, p_function.required_argument_count, p_arg_count));
+        return false;
+    }
+
+    return true;
+}
+
+bool OScriptVirtualMachine::_marshal_arguments(OScriptExecutionContext& p_context, const Function& p_function, const StringName& p_method, int p_arg_count, GDExtensionCallError* r_err)
+{
+    const int count = MIN(p_arg_count, static_cast<int>(p_function.argument_types.size()));
+    for (int i = 0; i < count; i++)
+    {
+        const Variant::Type expected = p_function.argument_types[i];
+        Variant& value = p_context._variant_stack[i];
+
+        const Variant::Type type = value.get_type();
+        if (expected == Variant::NIL || type == expected)
+            continue;
+
+        // Objects may be null, all other declared types require a value that converts without loss
+        if (expected == Variant::OBJECT ? type == Variant::NIL : Variant::can_convert_strict(type, expected))
+        {
+            if (expected != Variant::OBJECT)
+                value = VariantUtils::convert(value, expected);
+            continue;
+        }
+
+        r_err->error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
+        r_err->argument = i;
+        r_err->expected = expected;
+        ERR_PRINT(vformat("Invalid type for argument %d ('%s') of function '%s': expected %s but received %s.",
+            i + 1, p_function.argument_names[i], p_method, Variant::get_type_name(expected), Variant::get_type_name(type)));
+        return false;
+    }
+
+    for (int i = p_arg_count; i < p_function.argument_count; i++)
+    {
+        const int index = i - p_function.required_argument_count;
+        if (index >= 0 && index < static_cast<int>(p_function.default_arguments.size()))
+            p_context._variant_stack[i] = p_function.default_arguments[index];
+    }
+
+    return true;
+}
+
+void OScriptVirtualMachine::start_recording(OScriptExecutionRecorder* p_recorder)
+{
+    ERR_FAIL_NULL(p_recorder);
+
+    _recorder = p_recorder;
+    _record_track = p_recorder->add_track(_script.is_valid() ? _script->get_path() : String(), _random);
+}
+
+void OScriptVirtualMachine::record_result(const Variant& p_value)
+{
+    if (is_recording())
+        _recorder->record_result(_record_track, p_value);
+}
+
+void OScriptVirtualMachine::start_replay(OScriptExecutionRecorder::Cursor* p_cursor)
+{
+    ERR_FAIL_NULL(p_cursor);
+    ERR_FAIL_NULL(p_cursor->track);
+
+    _replay = p_cursor;
+    _random = p_cursor->track->random;
+}
+
+bool OScriptVirtualMachine::replay_call(OScriptInstance* p_instance, Variant& r_return, GDExtensionCallError& r_err)
+{
+    if (!_replay || !_replay->has_next(OScriptExecutionRecorder::EVENT_CALL))
+        return false;
+
+    const OScriptExecutionRecorder::Event& event = _replay->track->events[_replay->position++];
+
+    LocalVector<Variant> args;
+    LocalVector<const Variant*> arg_ptrs;
+    args.resize(event.values.size());
+    arg_ptrs.resize(event.values.size());
+    for (int i = 0; i < event.values.size(); i++)
+    {
+        args[i] = event.values[i];
+        arg_ptrs[i] = &args[i];
+    }
+
+    call_method(p_instance, event.method, arg_ptrs.ptr(), args.size(), &r_return, &r_err);
+    return true;
+}
+
+Variant OScriptVirtualMachine::replay_result(OScriptInstance* p_instance)
+{
+    ERR_FAIL_NULL_V(_replay, Variant());
+
+    // Signals and other callbacks the external call triggered on this instance
+    Variant call_return;
+    GDExtensionCallError call_err;
+    while (replay_call(p_instance, call_return, call_err))
+        call_return.clear();
+
+    if (!_replay->has_next(OScriptExecutionRecorder::EVENT_RESULT))
+    {
+        _replay->divergences++;
+        ERR_FAIL_V_MSG(Variant(), "Replay diverged from the recording, no result was recorded for an external call.");
+    }
+
+    const Array& values = _replay->track->events[_replay->position++].values;
+    return values.is_empty() ? Variant() : values[0];
+}
+
+OScriptExecutionStackInfo OScriptVirtualMachine::_get_stack_info(const Function& p_function) const
+{
+    OScriptExecutionStackInfo si;
+    si.max_stack_size = p_function.max_stack;
+    si.node_count = p_function.node_count;
+    si.max_inputs = _max_inputs;
+    si.max_outputs = _max_outputs;
+    si.flow_size = p_function.flow_stack_size;
+    si.pass_size = p_function.pass_stack_size;
+    return si;
+}
+
+bool OScriptVirtualMachine::initialize_dispatch(const Ref<OScriptDispatchTable>& p_table)
+{
+    ERR_FAIL_COND_V_MSG(!p_table.is_valid(), false, "Cannot initialize dispatch without a table");
+
+    _dispatch = p_table;
+    _dispatch_functions.resize(p_table->get_function_count());
+
+    for (int i = 0; i < p_table->get_function_count(); i++)
+    {
+        _dispatch_functions[i] = nullptr;
+
+        const HashMap<StringName, Function>::Iterator E = _functions.find(p_table->get_function_name(i));
+        if (!E)
+            continue;
+
+        Function& function = E->value;
+        if (!function.instance)
+        {
+            const HashMap<int, OScriptNodeInstance*>::Iterator N = _nodes.find(function.node);
+            if (!N)
+                continue;
+
+            function.instance = N->value;
+        }
+
+        // Functions that exceed the call stack are left to the lookup, which reports the error
+        if (function.max_stack > _max_call_stack)
+            continue;
+
+        // Prebuild the frame's initial layout, so that each call copies it rather than initializing each value
+        const OScriptExecutionStackInfo si = _get_stack_info(function);
+        function.frame.resize(si.get_stack_size());
+        memset(function.frame.ptr(), 0, function.frame.size());
+
+        OScriptExecutionContext context(si, function.frame.ptr(), 0, 0);
+        context._initialize_variant_stack();
+        context._push_node_onto_flow_stack(function.node);
+
+        _dispatch_functions[i] = &function;
+    }
+
+    return true;
+}
+
+int OScriptVirtualMachine::get_notification_argument_count() const
+{
+    if (!_dispatch.is_valid())
+    {
+        const Function* function = _functions.getptr("_notification");
+        return function ? function->argument_count : -1;
+    }
+
+    const int index = _dispatch->get_notification_index();
+    return index >= 0 && _dispatch_functions[index] ? _dispatch_functions[index]->argument_count : -1;
+}
+
+OScriptVirtualMachine::Function* OScriptVirtualMachine::_get_callable_function(const StringName& p_method, GDExtensionCallError* r_err)
+{
+    // Engine callbacks resolve through the dispatch table without probing the function map
+    if (_dispatch.is_valid())
+    {
+        const int index = _dispatch->lookup(p_method);
+        if (index == OScriptDispatchTable::MISSING)
+        {
+            r_err->error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+            return nullptr;
+        }
+
+        if (index >= 0 && _dispatch_functions[index])
+            return _dispatch_functions[index];
+    }
 
     // Check whether the method is defined as part of the Orchestration.
     // This means that there will be a function defined in the function map.
@@ -1046,8 +1451,7 @@ void OScriptVirtualMachine::call_method(OScriptInstance* p_instance, const Strin
     {
         // Method was not found, return invalid method
         r_err->error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
-        *r_return = Variant();
-        return;
+        return nullptr;
     }
 
     // Check whether the function has a node instance associated with it
@@ -1061,7 +1465,7 @@ void OScriptVirtualMachine::call_method(OScriptInstance* p_instance, const Strin
         {
             // No node found
             r_err->error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
-            ERR_FAIL_MSG("Unable to locate node for method '" + p_method + "' with node id " + itos(F->node));
+            ERR_FAIL_V_MSG(nullptr, "Unable to locate node for method '" + p_method + "' with node id " + itos(F->node));
         }
 
         // Lazily assign the instance reference
@@ -1070,41 +1474,143 @@ void OScriptVirtualMachine::call_method(OScriptInstance* p_instance, const Strin
 
     if (F->max_stack > _max_call_stack)
     {
-        ERR_FAIL_MSG("Unable to call function, call stack exceeds " + itos(_max_call_stack));
+        ERR_FAIL_V_MSG(nullptr, "Unable to call function, call stack exceeds " + itos(_max_call_stack));
     }
 
-    // Setup the execution stack
-    OScriptExecutionStackInfo si;
-    si.max_stack_size = F->max_stack;
-    si.node_count = F->node_count;
-    si.max_inputs = _max_inputs;
-    si.max_outputs = _max_outputs;
-    si.flow_size = F->flow_stack_size;
-    si.pass_size = F->pass_stack_size;
+    return F;
+}
 
-    const int stack_size = si.get_stack_size();
-    void* stack = alloca(stack_size);
-    memset(stack, 0, stack_size);
+void OScriptVirtualMachine::call_method(OScriptInstance* p_instance, const StringName& p_method, const Variant* const* p_args, GDExtensionInt p_arg_count, Variant* r_return, GDExtensionCallError* r_err)
+{
+    ERR_FAIL_COND_MSG(!r_err, "No error code argument provided.");
+
+    r_err->error = GDEXTENSION_CALL_OK;
 
-    OScriptExecutionContext context(si, stack, 0, 0);
-    context._initialize_variant_stack();
-    context._push_node_onto_flow_stack(F->node);
-    context._push_arguments(p_args, static_cast<int>(p_arg_count));
-    context._script_instance = p_instance;
+    // Calls made by this script's own graph are reproduced by a replay, and are not recorded
+    const bool script_call = _script_call;
+    _script_call = false;
+
+    Function* F = _get_callable_function(p_method, r_err);
+    if (!F)
+    {
+        if (r_err->error == GDEXTENSION_CALL_ERROR_INVALID_METHOD)
+            *r_return = Variant();
+        return;
+    }
 
-    // Dispatch to the internal handler
-    _call_method_internal(p_method, &context, false, F->instance, F, *r_return, *r_err);
+    if (!script_call && is_recording())
+        _recorder->record_call(_record_track, p_method, p_args, static_cast<int>(p_arg_count));
+
+    // Frames are allocated from the thread's frame stack rather than the native stack, so that
+    // deeply nested script calls are not bound by the native stack size.
+    OScriptFrameStack& frames = OScriptFrameStack::get_thread_stack();
+
+    // Tail calls collapse the call stack, so they're disabled while debugging
+    OScriptTailCall tail_call;
+    const bool tail_calls = !_debugging;
+
+    StringName method = p_method;
+    const Variant* const* args = p_args;
+    int arg_count = static_cast<int>(p_arg_count);
+    LocalVector<Variant> tail_args;
+    LocalVector<const Variant*> tail_arg_ptrs;
+
+    while (F)
+    {
+        // Pushing more arguments than declared would overrun the function's stack
+        if (!_check_argument_count(*F, method, arg_count, r_err))
+        {
+            *r_return = Variant();
+            return;
+        }
+
+        // Setup the execution stack
+        const OScriptExecutionStackInfo si = _get_stack_info(*F);
+
+        const int stack_size = si.get_stack_size();
+        void* stack = frames.push(stack_size);
+        ERR_FAIL_NULL_MSG(stack, "Unable to allocate frame for function '" + method + "'");
+
+        OScriptExecutionContext context(si, stack, 0, 0);
+        if (static_cast<int>(F->frame.size()) == stack_size)
+        {
+            // The initial frame layout was prebuilt when the dispatch table was assigned
+            memcpy(stack, F->frame.ptr(), stack_size);
+        }
+        else
+        {
+            memset(stack, 0, stack_size);
+            context._initialize_variant_stack();
+            context._push_node_onto_flow_stack(F->node);
+        }
+        context._push_arguments(args, arg_count);
+        context._script_instance = p_instance;
+        context._tail_call = tail_calls ? &tail_call : nullptr;
+
+        // Arguments are converted once on entry rather than by each node that reads them
+        if (!_marshal_arguments(context, *F, method, arg_count, r_err))
+        {
+            context._cleanup();
+            frames.pop(stack);
+            *r_return = Variant();
+            return;
+        }
+
+        // Dispatch to the internal handler
+        _call_method_internal(method, &context, false, F->instance, F, *r_return, *r_err);
+
+        frames.pop(stack);
+
+        if (!tail_call.pending)
+            break;
+
+        // Run the requested function in place of the function that just returned
+        tail_call.pending = false;
+        method = tail_call.method;
+
+        tail_args = tail_call.args;
+        tail_arg_ptrs.resize(tail_args.size());
+        for (uint32_t i = 0; i < tail_args.size(); i++)
+            tail_arg_ptrs[i] = &tail_args[i];
+
+        args = tail_arg_ptrs.ptr();
+        arg_count = static_cast<int>(tail_args.size());
+
+        F = _get_callable_function(method, r_err);
+        if (!F)
+            *r_return = Variant();
+    }
 }
 
 OScriptVirtualMachine::OScriptVirtualMachine()
 {
     _max_call_stack = OrchestratorSettings::get_singleton()->get_setting("settings/runtime/max_call_stack");
+
+    // The debugger is attached when the process starts, and remains so for its lifetime
+    EngineDebugger* debugger = EngineDebugger::get_singleton();
+    _debugging = debugger && debugger->is_active();
+
+    if (OScriptLanguage* language = OScriptLanguage::get_singleton())
+    {
+        _random = language->create_random_stream();
+        _profiler = language->get_node_profiler();
+    }
 }
 
 OScriptVirtualMachine::~OScriptVirtualMachine()
 {
+    // Retain the samples before the nodes are released
+    if (_profiler && _profile_session != 0)
+        _profiler->unregister_machine(this, _profile_session);
+
     for (const KeyValue<int, OScriptNodeInstance*>& E : _nodes)
         memdelete(E.value);
 
     _nodes.clear();
+
+    if (_boxed_variables)
+        memdelete_arr(_boxed_variables);
+
+    if (_typed_variables_alloc)
+        memfree(_typed_variables_alloc);
 }
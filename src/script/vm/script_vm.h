@@ -17,8 +17,15 @@
 #ifndef ORCHESTRATOR_SCRIPT_VIRTUAL_MACHINE_H
 #define ORCHESTRATOR_SCRIPT_VIRTUAL_MACHINE_H
 
+#include "script/vm/dispatch_table.h"
+#include "script/vm/execution_recorder.h"
+#include "script/vm/node_profiler.h"
+#include "script/vm/random_stream.h"
+#include "script/vm/variable_layout.h"
+
 #include <godot_cpp/classes/script.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/templates/rb_set.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
@@ -29,6 +36,7 @@ class Orchestration;
 class OScriptCompileContext;
 class OScriptExecutionContext;
 class OScriptExecutionStack;
+struct OScriptExecutionStackInfo;
 class OScriptFunction;
 class OScriptInstance;
 class OScriptLanguage;
@@ -57,27 +65,38 @@ public:
         int node_count{ 0 };                       //! Number of nodes in the function's graph
         int argument_count{ 0 };                   //! Number of function arguments
         OScriptNodeInstance* instance{ nullptr };  //! Cached instance of the node that starts this function
-    };
-
-    /// Defines details about a variable
-    struct Variable
-    {
-        Variant value;       //! The variable's current value
-        bool exported;       //! Publically accessible, exported
-        Variant::Type type;  //! Variable type
+        LocalVector<uint8_t> frame;                //! Prebuilt initial frame layout, if built
+        LocalVector<Variant::Type> argument_types; //! Declared argument types, <code>NIL</code> accepts any value
+        LocalVector<StringName> argument_names;    //! Argument names, used for error messages
+        int required_argument_count{ 0 };          //! Number of arguments without default values
+        LocalVector<Variant> default_arguments;    //! Default values of the trailing arguments
     };
 
 protected:
 
     Object* _owner{ nullptr };                  //! The owner
     Ref<Script> _script;                        //! The script
-    HashMap<StringName, Variable> _variables;   //! Defined Variables
+    Ref<OScriptVariableLayout> _variable_layout; //! The script's variable layout
+    uint8_t* _typed_variables{ nullptr };       //! Unboxed variable storage, aligned per the layout
+    void* _typed_variables_alloc{ nullptr };    //! Allocation backing the unboxed variable storage
+    Variant* _boxed_variables{ nullptr };       //! Boxed variable storage
     HashMap<StringName, Function> _functions;   //! Defined functions
     HashMap<int, OScriptNodeInstance*> _nodes;  //! Nodes
     Vector<Variant> _default_values;            //! Default values
     int _max_inputs{ 0 };                       //! Maximum number of input arguments
     int _max_outputs{ 0 };                      //! Maximum number of output arguments
     int _max_call_stack{ 0 };                   //! Maximum call stack
+    OScriptRandomStream _random;                //! The instance's random stream
+    Ref<OScriptDispatchTable> _dispatch;        //! The script's method dispatch table
+    LocalVector<Function*> _dispatch_functions; //! Functions indexed by dispatch table index
+    bool _debugging{ false };                   //! Whether the engine debugger is active
+    OScriptNodeProfiler* _profiler{ nullptr };  //! The node profiler
+    uint32_t _profile_session{ 0 };             //! The profiler session the node samples belong to
+    OScriptExecutionRecorder* _recorder{ nullptr }; //! The recorder, while recording
+    int _record_track{ -1 };                    //! The instance's recording track
+    int _record_pause{ 0 };                     //! Recording is paused while resuming from await
+    bool _script_call{ false };                 //! Whether the next call is made by this script's own graph
+    OScriptExecutionRecorder::Cursor* _replay{ nullptr }; //! The replay cursor, while replaying
 
     /// Sets unassigned inputs on the specified node, if any exist.
     /// @param p_node the script node
@@ -109,13 +128,21 @@ protected:
     /// @return true if the pins are created successfully, false otherwise
     bool _create_node_instance_pins(const Ref<OScriptNode>& p_node, OScriptNodeInstance* p_instance);
 
+    /// Infers the static types of a node's data inputs from the connected output pins and literal defaults.
+    /// @param p_orchestration the orchestration
+    /// @param p_node the script node
+    /// @param p_lookup the data connection lookup
+    /// @param r_types the inferred type for each data input, <code>NIL</code> when not known
+    void _infer_input_types(Orchestration* p_orchestration, const Ref<OScriptNode>& p_node, const HashMap<int, HashMap<int, Pair<int, int>>>& p_lookup, Vector<Variant::Type>& r_types);
+
     /// Create a node instance
     /// @param p_orchestration the orchestration
     /// @param p_node_id the node ID
     /// @param r_function the function declaration
     /// @param r_lv_indices the constructe local variable indices
+    /// @param p_lookup the data connection lookup, used for type inference
     /// @return true if the node instance was created successfully, false otherwise
-    bool _create_node_instance(Orchestration* p_orchestration, int p_node_id, Function& r_function, HashMap<String, int>& r_lv_indices);
+    bool _create_node_instance(Orchestration* p_orchestration, int p_node_id, Function& r_function, HashMap<String, int>& r_lv_indices, const HashMap<int, HashMap<int, Pair<int, int>>>& p_lookup);
 
     /// Build the function's node graph
     /// @param p_function the script function
@@ -152,6 +179,25 @@ protected:
     /// @return the step result
     int _execute_step(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance);
 
+    /// Executes the node's step, sampling its execution count and time for the node profiler
+    /// @param p_context the execution context
+    /// @param p_instance the node instance
+    /// @return the step result
+    int _execute_profiled_step(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance);
+
+    /// Records the step result and outputs of a node that reads external state
+    /// @param p_context the execution context
+    /// @param p_instance the node instance
+    /// @param p_result the step result
+    void _record_step(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance, int p_result);
+
+    /// Replays the recorded step result and outputs of a node that reads external state, rather than
+    /// executing it. Calls recorded into the instance before the step are replayed first.
+    /// @param p_context the execution context
+    /// @param p_instance the node instance
+    /// @return the recorded step result
+    int _replay_step(OScriptExecutionContext& p_context, OScriptNodeInstance* p_instance);
+
     /// Resolve the next node instance to step
     /// @param p_context the execution context
     /// @param p_instance the previously executed node instance
@@ -189,6 +235,36 @@ protected:
     /// @param r_err the return error code
     void _call_method_internal(const StringName& p_method, OScriptExecutionContext* p_context, bool p_resume, OScriptNodeInstance* p_instance, Function* p_function, Variant& r_return, GDExtensionCallError& r_err);
 
+    /// Get the execution stack layout for a function
+    /// @param p_function the function
+    /// @return the stack layout
+    OScriptExecutionStackInfo _get_stack_info(const Function& p_function) const;
+
+    /// Validates the number of arguments passed to a function
+    /// @param p_function the function
+    /// @param p_method the function name
+    /// @param p_arg_count the number of arguments
+    /// @param r_err the call error, set when the argument count is invalid
+    /// @return true if the argument count is valid, false otherwise
+    bool _check_argument_count(const Function& p_function, const StringName& p_method, int p_arg_count, GDExtensionCallError* r_err);
+
+    /// Validates the arguments pushed onto the stack against the function's signature, converting
+    /// each argument that differs from its declared type so that nodes receive the declared type.
+    /// Trailing arguments that were not passed take their default values.
+    /// @param p_context the execution context
+    /// @param p_function the function
+    /// @param p_method the function name
+    /// @param p_arg_count the number of arguments
+    /// @param r_err the call error, set when an argument has an invalid type
+    /// @return true if the arguments are valid, false otherwise
+    bool _marshal_arguments(OScriptExecutionContext& p_context, const Function& p_function, const StringName& p_method, int p_arg_count, GDExtensionCallError* r_err);
+
+    /// Looks up a function by name, lazily resolving the node instance that starts the function
+    /// @param p_method the method name
+    /// @param r_err the call error, set when the method is not found
+    /// @return the function, or <code>nullptr</code> if it cannot be called
+    Function* _get_callable_function(const StringName& p_method, GDExtensionCallError* r_err);
+
 public:
     /// Get the owner of the virtual machine
     /// @return the owner
@@ -202,20 +278,76 @@ public:
     /// @param p_script the script instance
     void set_script(const Ref<Script>& p_script) { _script = p_script; }
 
-    /// Register a variable
-    /// @param p_variable the variable to be registered
-    /// @return true if the variable was registered successfully, false otherwise
-    bool register_variable(const Ref<OScriptVariable>& p_variable);
+    /// Get the path of the script this machine executes
+    /// @return the script path, empty if there is no script
+    String get_script_path() const { return _script.is_valid() ? _script->get_path() : String(); }
+
+    /// Adds the node samples taken for the node profiler
+    /// @param r_samples the samples, by node id
+    void collect_node_samples(OScriptNodeProfiler::NodeSamples& r_samples) const;
+
+    /// Get the instance's random stream, used by nodes that draw random values
+    /// @return the random stream
+    _FORCE_INLINE_ OScriptRandomStream& get_random() { return _random; }
+
+    /// Initializes the variable storage described by the layout, assigning default values
+    /// @param p_layout the script's variable layout
+    /// @param p_typed_storage aligned storage for the typed block, owned by the caller; allocated if <code>nullptr</code>
+    /// @return true if the variables were initialized successfully, false otherwise
+    bool initialize_variables(const Ref<OScriptVariableLayout>& p_layout, uint8_t* p_typed_storage = nullptr);
+
+    /// Get the variable layout the storage was initialized with
+    /// @return the variable layout, invalid if the variables are not initialized
+    const Ref<OScriptVariableLayout>& get_variable_layout() const { return _variable_layout; }
+
+    /// Get the unboxed variable storage described by the layout
+    /// @return the typed storage block, <code>nullptr</code> if there are no typed variables
+    _FORCE_INLINE_ uint8_t* get_typed_variables() const { return _typed_variables; }
+
+    /// Get the boxed variable storage described by the layout
+    /// @return the boxed storage, <code>nullptr</code> if there are no boxed variables
+    _FORCE_INLINE_ Variant* get_boxed_variables() const { return _boxed_variables; }
 
     /// Check whether the script has a variable
     /// @param p_name the variable name
     /// @return true if the variable exists, false otherwise
     bool has_variable(const StringName& p_name) const;
 
-    /// Gets the variable by name
+    /// Get the variable's slot index
     /// @param p_name the variable name
-    /// @return the variable if found, otherwise returns null
-    Variable* get_variable(const StringName& p_name) const;
+    /// @return the slot index, or -1 if the variable does not exist
+    int get_variable_index(const StringName& p_name) const;
+
+    /// Get the variable's slot details
+    /// @param p_index the slot index
+    /// @return the variable slot
+    _FORCE_INLINE_ const OScriptVariableLayout::Slot& get_variable_slot(int p_index) const { return _variable_layout->get_slot(p_index); }
+
+    /// Get the value of a variable by slot index
+    /// @param p_index the slot index
+    /// @param r_value the variable's value
+    _FORCE_INLINE_ void get_variable_value(int p_index, Variant& r_value) const
+    {
+        const OScriptVariableLayout::Slot& slot = _variable_layout->get_slot(p_index);
+        if (slot.typed)
+            OScriptVariableLayout::read(slot.type, _typed_variables + slot.offset, r_value);
+        else
+            r_value = _boxed_variables[slot.offset];
+    }
+
+    /// Set the value of a variable by slot index
+    /// @param p_index the slot index
+    /// @param p_value the value, converted to the variable's declared type when stored unboxed
+    /// @return true if the value was set, false if the value could not be converted
+    _FORCE_INLINE_ bool set_variable_value(int p_index, const Variant& p_value)
+    {
+        const OScriptVariableLayout::Slot& slot = _variable_layout->get_slot(p_index);
+        if (slot.typed)
+            return OScriptVariableLayout::write(slot.type, _typed_variables + slot.offset, p_value);
+
+        _boxed_variables[slot.offset] = p_value;
+        return true;
+    }
 
     /// Get the value of a variable
     /// @param p_name the variable name
@@ -244,6 +376,53 @@ public:
     /// @return true if the function was registered successfully, false othrewise
     bool register_function(const Ref<OScriptFunction>& p_function);
 
+    /// Assigns the script's dispatch table, resolving each function and prebuilding its initial frame.
+    /// Must be called after all functions are registered.
+    /// @param p_table the dispatch table
+    /// @return true if the dispatch table was assigned, false otherwise
+    bool initialize_dispatch(const Ref<OScriptDispatchTable>& p_table);
+
+    /// Get the number of arguments the script's <code>_notification</code> function declares
+    /// @return the declared argument count, or -1 if the script does not implement notifications
+    int get_notification_argument_count() const;
+
+    /// Starts recording the external inputs this instance consumes
+    /// @param p_recorder the recorder
+    void start_recording(OScriptExecutionRecorder* p_recorder);
+
+    /// Check whether external inputs are being recorded
+    /// @return true if recording, false otherwise
+    _FORCE_INLINE_ bool is_recording() const { return _recorder && _record_pause == 0; }
+
+    /// Records the result of an external call made by the graph
+    /// @param p_value the result
+    void record_result(const Variant& p_value);
+
+    /// Marks the next call into this instance as made by its own graph, which is not recorded
+    /// @param p_script_call whether the next call is made by the graph
+    _FORCE_INLINE_ void set_script_call(bool p_script_call) { _script_call = p_script_call; }
+
+    /// Starts replaying a recorded track, restoring the instance's random stream
+    /// @param p_cursor the replay cursor, which must outlive the replay
+    void start_replay(OScriptExecutionRecorder::Cursor* p_cursor);
+
+    /// Check whether recorded inputs are being replayed
+    /// @return true if replaying, false otherwise
+    _FORCE_INLINE_ bool is_replaying() const { return _replay != nullptr; }
+
+    /// Replays the next recorded call into the instance
+    /// @param p_instance the script instance
+    /// @param r_return the return value
+    /// @param r_err the call error
+    /// @return true if a call was replayed, false if the next event is not a call
+    bool replay_call(OScriptInstance* p_instance, Variant& r_return, GDExtensionCallError& r_err);
+
+    /// Replays the result of an external call made by the graph. Calls recorded into the instance
+    /// while the external call was running are replayed first.
+    /// @param p_instance the script instance
+    /// @return the recorded result
+    Variant replay_result(OScriptInstance* p_instance);
+
     /// Executes or calls the specified method
     /// @param p_instance the script instance that made the call
     /// @param p_method the method name to run
@@ -0,0 +1,169 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/vm/variable_layout.h"
+
+#include "common/variant_utils.h"
+#include "script/variable.h"
+
+#define LAYOUT_TYPE_CASES(m_case)             \
+    m_case(Variant::BOOL, bool)               \
+    m_case(Variant::INT, int64_t)             \
+    m_case(Variant::FLOAT, double)            \
+    m_case(Variant::VECTOR2, Vector2)         \
+    m_case(Variant::VECTOR2I, Vector2i)       \
+    m_case(Variant::RECT2, Rect2)             \
+    m_case(Variant::RECT2I, Rect2i)           \
+    m_case(Variant::VECTOR3, Vector3)         \
+    m_case(Variant::VECTOR3I, Vector3i)       \
+    m_case(Variant::TRANSFORM2D, Transform2D) \
+    m_case(Variant::VECTOR4, Vector4)         \
+    m_case(Variant::VECTOR4I, Vector4i)       \
+    m_case(Variant::PLANE, Plane)             \
+    m_case(Variant::QUATERNION, Quaternion)   \
+    m_case(Variant::AABB, AABB)               \
+    m_case(Variant::BASIS, Basis)             \
+    m_case(Variant::TRANSFORM3D, Transform3D) \
+    m_case(Variant::PROJECTION, Projection)   \
+    m_case(Variant::COLOR, Color)
+
+int OScriptVariableLayout::get_typed_size(Variant::Type p_type)
+{
+    switch (p_type)
+    {
+        #define SIZE_CASE(m_type, m_native) case m_type: return sizeof(m_native);
+        LAYOUT_TYPE_CASES(SIZE_CASE)
+        #undef SIZE_CASE
+        default:
+            return 0;
+    }
+}
+
+void OScriptVariableLayout::read(Variant::Type p_type, const uint8_t* p_data, Variant& r_value)
+{
+    switch (p_type)
+    {
+        #define READ_CASE(m_type, m_native) case m_type: r_value = *reinterpret_cast<const m_native*>(p_data); break;
+        LAYOUT_TYPE_CASES(READ_CASE)
+        #undef READ_CASE
+        default:
+            ERR_PRINT("Cannot read an unboxed value of type " + Variant::get_type_name(p_type));
+            r_value = Variant();
+            break;
+    }
+}
+
+bool OScriptVariableLayout::write(Variant::Type p_type, uint8_t* p_data, const Variant& p_value)
+{
+    if (p_value.get_type() != p_type && !Variant::can_convert(p_value.get_type(), p_type))
+        return false;
+
+    switch (p_type)
+    {
+        #define WRITE_CASE(m_type, m_native) case m_type: *reinterpret_cast<m_native*>(p_data) = p_value; return true;
+        LAYOUT_TYPE_CASES(WRITE_CASE)
+        #undef WRITE_CASE
+        default:
+            return false;
+    }
+}
+
+void OScriptVariableLayout::build(const HashMap<StringName, Ref<OScriptVariable>>& p_variables)
+{
+    _slots.clear();
+    _slot_indices.clear();
+    _typed_size = 0;
+    _boxed_count = 0;
+    _typed_defaults.clear();
+    _boxed_defaults.clear();
+
+    for (const KeyValue<StringName, Ref<OScriptVariable>>& E : p_variables)
+    {
+        Slot slot;
+        slot.name = E.key;
+        slot.type = E.value->get_variable_type();
+        slot.exported = E.value->is_exported();
+        slot.default_value = E.value->get_default_value();
+
+        const int size = get_typed_size(slot.type);
+        if (size > 0)
+        {
+            // Align each member to its natural alignment, capped at the block alignment
+            const int alignment = size >= ALIGNMENT ? ALIGNMENT : (size >= 8 ? 8 : (size >= 4 ? 4 : 1));
+            _typed_size = (_typed_size + alignment - 1) & ~(alignment - 1);
+
+            slot.typed = true;
+            slot.offset = _typed_size;
+            _typed_size += size;
+        }
+        else
+        {
+            slot.typed = false;
+            slot.offset = _boxed_count++;
+        }
+
+        _slot_indices[slot.name] = static_cast<int>(_slots.size());
+        _slots.push_back(slot);
+    }
+
+    _typed_size = (_typed_size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+    // Pre-initialize the default values once, so instances only need to copy them
+    _typed_defaults.resize(_typed_size);
+    if (_typed_size > 0)
+        memset(_typed_defaults.ptr(), 0, _typed_size);
+
+    _boxed_defaults.resize(_boxed_count);
+
+    for (const Slot& slot : _slots)
+    {
+        if (!slot.typed)
+            _boxed_defaults[slot.offset] = slot.default_value;
+        else if (!write(slot.type, _typed_defaults.ptr() + slot.offset, slot.default_value))
+        {
+            // Typed slots cannot hold values that fail to convert, i.e. nil
+            write(slot.type, _typed_defaults.ptr() + slot.offset, VariantUtils::make_default(slot.type));
+        }
+    }
+}
+
+bool OScriptVariableLayout::matches(const HashMap<StringName, Ref<OScriptVariable>>& p_variables) const
+{
+    if (p_variables.size() != _slots.size())
+        return false;
+
+    for (const KeyValue<StringName, Ref<OScriptVariable>>& E : p_variables)
+    {
+        const HashMap<StringName, int>::ConstIterator S = _slot_indices.find(E.key);
+        if (!S)
+            return false;
+
+        const Slot& slot = _slots[S->value];
+        if (slot.type != E.value->get_variable_type() || slot.exported != E.value->is_exported())
+            return false;
+
+        if (slot.default_value != E.value->get_default_value())
+            return false;
+    }
+
+    return true;
+}
+
+int OScriptVariableLayout::find_slot(const StringName& p_name) const
+{
+    const HashMap<StringName, int>::ConstIterator E = _slot_indices.find(p_name);
+    return E ? E->value : -1;
+}
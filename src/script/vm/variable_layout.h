@@ -0,0 +1,127 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef ORCHESTRATOR_SCRIPT_VARIABLE_LAYOUT_H
+#define ORCHESTRATOR_SCRIPT_VARIABLE_LAYOUT_H
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+using namespace godot;
+
+/// Forward declarations
+class OScriptVariable;
+
+/// Describes how a script's member variables are stored at runtime.
+///
+/// Variables declared with a fixed-size value type, such as <code>int</code>, <code>float</code> or
+/// <code>Vector3</code>, are stored unboxed in a single 16-byte aligned block, avoiding the cost of
+/// Variant construction and type dispatch on each access. All other variables, i.e. those declared
+/// as <code>Variant</code>, objects, strings or containers, fall back to boxed Variant storage.
+///
+/// The layout only depends on the declared variables, and is therefore shared by all instances of a
+/// script. Each script instance owns the storage described by the layout.
+///
+class OScriptVariableLayout : public RefCounted
+{
+    GDCLASS(OScriptVariableLayout, RefCounted);
+    static void _bind_methods() { }
+
+public:
+    /// The alignment of the typed storage block
+    static constexpr int ALIGNMENT = 16;
+
+    /// Describes a single variable slot
+    struct Slot
+    {
+        StringName name;                   //! The variable name
+        Variant::Type type{ Variant::NIL }; //! The declared variable type
+        Variant default_value;             //! The variable's default value
+        bool exported{ false };            //! Whether the variable is exported
+        bool typed{ false };               //! Whether stored unboxed in the typed block
+        int offset{ 0 };                   //! Byte offset in the typed block, or index in the boxed storage
+    };
+
+private:
+    LocalVector<Slot> _slots;                 //! Variable slots, in declaration order
+    HashMap<StringName, int> _slot_indices;   //! Maps variable names to slot indices
+    int _typed_size{ 0 };                     //! Size of the typed block in bytes
+    int _boxed_count{ 0 };                    //! Number of boxed variables
+    LocalVector<uint8_t> _typed_defaults;     //! Pre-initialized typed block, copied into each instance
+    LocalVector<Variant> _boxed_defaults;     //! Default values of the boxed variables, by boxed index
+
+public:
+    /// Get the byte size of an unboxed value of the specified type
+    /// @param p_type the variant type
+    /// @return the byte size, or 0 if the type must be boxed
+    static int get_typed_size(Variant::Type p_type);
+
+    /// Reads an unboxed value
+    /// @param p_type the value type
+    /// @param p_data pointer to the unboxed data
+    /// @param r_value the boxed value
+    static void read(Variant::Type p_type, const uint8_t* p_data, Variant& r_value);
+
+    /// Writes an unboxed value, converting the value to the slot type
+    /// @param p_type the value type
+    /// @param p_data pointer to the unboxed data
+    /// @param p_value the value to write
+    /// @return true if the value was written, false if the value cannot be converted
+    static bool write(Variant::Type p_type, uint8_t* p_data, const Variant& p_value);
+
+    /// Builds the layout from the script's variables
+    /// @param p_variables the variables
+    void build(const HashMap<StringName, Ref<OScriptVariable>>& p_variables);
+
+    /// Check whether the layout still describes the specified variables
+    /// @param p_variables the variables
+    /// @return true if the layout matches, false if it should be rebuilt
+    bool matches(const HashMap<StringName, Ref<OScriptVariable>>& p_variables) const;
+
+    /// Get the slot index for a given variable
+    /// @param p_name the variable name
+    /// @return the slot index or -1 if the variable does not exist
+    int find_slot(const StringName& p_name) const;
+
+    /// Get the number of slots
+    /// @return the number of variable slots
+    int get_slot_count() const { return static_cast<int>(_slots.size()); }
+
+    /// Get the slot at the specified index
+    /// @param p_index the slot index
+    /// @return the slot
+    _FORCE_INLINE_ const Slot& get_slot(int p_index) const { return _slots[p_index]; }
+
+    /// Get the size of the typed storage block
+    /// @return the size in bytes, always a multiple of the alignment
+    int get_typed_size() const { return _typed_size; }
+
+    /// Get the number of boxed variables
+    /// @return the number of boxed variables
+    int get_boxed_count() const { return _boxed_count; }
+
+    /// Get the typed block with all typed variables set to their default values
+    /// @return the default typed block, <code>nullptr</code> if there are no typed variables
+    _FORCE_INLINE_ const uint8_t* get_typed_defaults() const { return _typed_defaults.ptr(); }
+
+    /// Get the default value of a boxed variable
+    /// @param p_index the boxed index
+    /// @return the default value
+    _FORCE_INLINE_ const Variant& get_boxed_default(int p_index) const { return _boxed_defaults[p_index]; }
+};
+
+#endif  // ORCHESTRATOR_SCRIPT_VARIABLE_LAYOUT_H